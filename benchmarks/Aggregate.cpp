@@ -0,0 +1,35 @@
+#include <vector>
+
+#include "Units/Units.h"
+#include "Units/Aggregate.h"
+
+#include "Benchmark.h"
+
+using namespace Units;
+
+int main()
+{
+	const size_t count = 10000000;
+
+	std::vector<double> magnitudes(count);
+	std::vector<Quantity> quantities(count);
+
+	for(size_t i = 0; i < count; i++)
+	{
+		magnitudes[i] = 0.1 * (double)(i % 1000);
+		quantities[i] = (i % 8 == 0 ? Quantity(magnitudes[i] / 1000.0, Unit(1000.0, m)) : Quantity(magnitudes[i], m));
+	}
+
+	const QuantityArray column(magnitudes, m);
+
+	Bench::report("Quantity::operator+= loop", Bench::measure([&] {
+		Quantity total = 0.0 * m;
+		for(const Quantity& q : quantities) total += q;
+		Bench::keep(total);
+	}), (double)count);
+
+	Bench::report("Stats::sum (Quantity range)", Bench::measure([&] { Bench::keep(Stats::sum(quantities)); }), (double)count);
+	Bench::report("Stats::sum (QuantityArray)", Bench::measure([&] { Bench::keep(Stats::sum(column)); }), (double)count);
+	Bench::report("Stats::variance (QuantityArray)", Bench::measure([&] { Bench::keep(Stats::variance(column)); }), (double)count);
+	Bench::report("Stats::max (QuantityArray)", Bench::measure([&] { Bench::keep(Stats::max(column)); }), (double)count);
+}
@@ -0,0 +1,41 @@
+#include <vector>
+
+#include "Units/Units.h"
+#include "Units/Arithmetic.h"
+
+#include "Benchmark.h"
+
+using namespace Units;
+
+int main()
+{
+	const size_t n = 2000000;
+
+	std::vector<double> volts(n), amps(n);
+	std::vector<Quantity> voltage(n), current(n), power(n);
+
+	for(size_t i = 0; i < n; i++)
+	{
+		volts[i] = 0.01 * (double)(i % 1000);
+		amps[i] = 0.5 + 0.001 * (double)(i % 100);
+		voltage[i] = Quantity(volts[i], V);
+		current[i] = Quantity(amps[i], A);
+	}
+
+	const QuantityArray voltageColumn(volts, V);
+	const QuantityArray currentColumn(amps, A);
+	const QuantityArray powerColumn = voltageColumn * currentColumn;
+
+	Bench::report("Quantity::operator* loop", Bench::measure([&] {
+		for(size_t i = 0; i < n; i++) power[i] = voltage[i] * current[i];
+		Bench::keep(power[n - 1]);
+	}), (double)n);
+
+	Bench::report("multiply (Quantity range)", Bench::measure([&] {
+		multiply(voltage.data(), voltage.data() + n, current.data(), power.data());
+		Bench::keep(power[n - 1]);
+	}), (double)n);
+
+	Bench::report("operator* (QuantityArray)", Bench::measure([&] { Bench::keep((voltageColumn * currentColumn)[n - 1]); }), (double)n);
+	Bench::report("fma (QuantityArray)", Bench::measure([&] { Bench::keep(fma(voltageColumn, currentColumn, powerColumn)[n - 1]); }), (double)n);
+}
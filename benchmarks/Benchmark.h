@@ -0,0 +1,41 @@
+#pragma once
+
+#include <chrono>
+#include <cstdio>
+
+namespace Bench
+{
+	/** @brief Runs the given function a number of times and returns the best time, in milliseconds */
+	template<typename Function>
+	double measure(Function fn, int repetitions = 5)
+	{
+		double best = 0.0;
+
+		for(int i = 0; i < repetitions; i++)
+		{
+			const auto start = std::chrono::steady_clock::now();
+			fn();
+			const auto end = std::chrono::steady_clock::now();
+
+			const double elapsed = std::chrono::duration<double, std::milli>(end - start).count();
+			if(i == 0 || elapsed < best) best = elapsed;
+		}
+
+		return best;
+	}
+
+	/** @brief Prints a benchmark result */
+	inline void report(const char* name, double ms, double items)
+	{
+		std::printf("%-40s %10.3f ms %12.1f M items/s\n", name, ms, items / ms / 1000.0);
+	}
+
+	/** @brief Prevents the compiler from optimizing away a computed value */
+	template<typename T>
+	void keep(const T& value)
+	{
+		static volatile const void* sink;
+		sink = &value;
+		(void)sink;
+	}
+}
@@ -0,0 +1,87 @@
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "Units/Units.h"
+#include "Units/CsvReader.h"
+#include "Units/IO.h"
+
+#include "Benchmark.h"
+
+using namespace Units;
+
+int main()
+{
+	const size_t rows = 1000000;
+
+	std::string text = "temperature [K],flow [L/min],energy (kWh),pressure [kPa]\n";
+	for(size_t i = 0; i < rows; i++)
+	{
+		char line[128];
+		std::snprintf(line, sizeof(line), "%.2f,%.3f,%.1f,%.2f\n", 273.15 + 0.01 * (double)(i % 5000), 0.001 * (double)(i % 997), 0.1 * (double)i, 101.3 + 0.01 * (double)(i % 300));
+		text += line;
+	}
+
+	double ms = Bench::measure([&] {
+		// Baseline: a plain numeric CSV parser with no units
+		std::vector<std::vector<double>> columns(4);
+		const char* it = std::strchr(text.c_str(), '\n') + 1;
+
+		while(*it != '\0')
+		{
+			for(size_t column = 0; column < 4; column++)
+			{
+				char* end;
+				columns[column].push_back(std::strtod(it, &end));
+				it = end + 1;
+			}
+		}
+
+		Bench::keep(columns);
+	});
+	Bench::report("strtod per cell, no units", ms, (double)rows);
+	std::printf("%-40s %10.3f GB/s\n", "", (double)text.size() / ms / 1e6);
+
+	ms = Bench::measure([&] {
+		CsvReader reader;
+		reader.feed(text);
+		reader.finish();
+		Bench::keep(reader.columns());
+	});
+	Bench::report("CsvReader, units in header", ms, (double)rows);
+	std::printf("%-40s %10.3f GB/s\n", "", (double)text.size() / ms / 1e6);
+
+	ms = Bench::measure([&] {
+		CsvReader reader;
+
+		for(size_t offset = 0; offset < text.size(); offset += 4096)
+			reader.feed(text.data() + offset, std::min<size_t>(4096, text.size() - offset));
+
+		reader.finish();
+		Bench::keep(reader.columns());
+	});
+	Bench::report("CsvReader, 4 KiB chunks", ms, (double)rows);
+	std::printf("%-40s %10.3f GB/s\n", "", (double)text.size() / ms / 1e6);
+
+	ms = Bench::measure([&] {
+		std::vector<Quantity> cells;
+		const char* units[] = { " K", " L/min", " kWh", " kPa" };
+		const char* it = std::strchr(text.c_str(), '\n') + 1;
+
+		while(*it != '\0')
+		{
+			for(size_t column = 0; column < 4; column++)
+			{
+				const char* end = it + std::strcspn(it, ",\n");
+				cells.push_back(to_quantity(std::string(it, end) + units[column]));
+				it = end + 1;
+			}
+		}
+
+		Bench::keep(cells);
+	}, 1);
+	Bench::report("to_quantity per suffixed cell", ms, (double)rows);
+}
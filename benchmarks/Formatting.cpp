@@ -0,0 +1,59 @@
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "Units/Units.h"
+#include "Units/IO.h"
+
+#include "Benchmark.h"
+
+using namespace Units;
+
+// Usage: format_bench [max_threads]
+//
+// Every thread formats the same few units over and over, so after the first
+// round every call hits the format index of the registry snapshot
+int main(int argc, char** argv)
+{
+	const size_t calls = 2000000;
+	const Unit units[] = { m, m / s, kg * (m^2), Unit(1e3, m) / h, N * m, W / (m^2), ft / s, Unit(1e-3, L), Pa * s, J / (kg * K) };
+	const size_t unitCount = sizeof(units) / sizeof(units[0]);
+
+	const unsigned hardware = std::max(1u, std::thread::hardware_concurrency());
+	const unsigned maxThreads = (argc > 1 ? (unsigned)std::max(1, std::atoi(argv[1])) : std::max(4u, hardware));
+
+	for(unsigned threads = 1; threads <= maxThreads; threads *= 2)
+	{
+		char name[64];
+		std::snprintf(name, sizeof(name), "to_string(Unit), %u thread(s)", threads);
+
+		Bench::report(name, Bench::measure([&] {
+			std::atomic<size_t> length(0);
+			std::vector<std::thread> workers;
+
+			for(unsigned t = 0; t < threads; t++)
+			{
+				workers.emplace_back([&, t] {
+					size_t total = 0;
+					for(size_t i = t; i < calls; i += threads) total += to_string(units[i % unitCount]).size();
+					length += total;
+				});
+			}
+
+			for(std::thread& worker : workers) worker.join();
+			Bench::keep(length.load());
+		}), (double)calls);
+	}
+
+	const Quantity quantities[] = { 12.5 * m, 3.0 * (m / s), 0.25 * N * m, 1500.0 * W / (m^2) };
+
+	Bench::report("to_string(Quantity), 1 thread", Bench::measure([&] {
+		size_t total = 0;
+		for(size_t i = 0; i < calls; i++) total += to_string(quantities[i % 4]).size();
+		Bench::keep(total);
+	}), (double)calls);
+}
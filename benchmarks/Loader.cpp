@@ -0,0 +1,43 @@
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <thread>
+
+#include "Units/Units.h"
+#include "Units/Loader.h"
+
+#include "Benchmark.h"
+
+using namespace Units;
+
+// Usage: loader_bench [max_threads]
+int main(int argc, char** argv)
+{
+	const char* path = "loader_bench.txt";
+	const char* units[] = { "kPa", "m/s", "m/s^2", "kWh", "mV", "Hz", "kg" };
+	const size_t lines = 4000000;
+
+	std::FILE* file = std::fopen(path, "wb");
+	if(file == nullptr) return 1;
+
+	for(size_t i = 0; i < lines; i++)
+		std::fprintf(file, "%.3f %s\n", 0.001 * (double)(i % 100000) - 12.5, units[i % 7]);
+
+	const long bytes = std::ftell(file);
+	std::fclose(file);
+
+	const unsigned hardware = std::max(1u, std::thread::hardware_concurrency());
+	const unsigned maxThreads = (argc > 1 ? (unsigned)std::max(1, std::atoi(argv[1])) : hardware);
+
+	for(unsigned threads = 1; threads <= maxThreads; threads *= 2)
+	{
+		char name[64];
+		std::snprintf(name, sizeof(name), "load_quantities, %u thread(s)", threads);
+
+		const double ms = Bench::measure([&] { Bench::keep(load_quantities(path, LoadOptions(threads))); }, 3);
+		Bench::report(name, ms, (double)lines);
+		std::printf("%-40s %10.3f GB/s\n", "", (double)bytes / ms / 1e6);
+	}
+
+	std::remove(path);
+}
@@ -0,0 +1,35 @@
+#include <cstdio>
+#include <cstdlib>
+#include <thread>
+#include <vector>
+
+#include "Units/Units.h"
+#include "Units/Parallel.h"
+
+#include "Benchmark.h"
+
+using namespace Units;
+
+// Usage: parallel_bench [max_threads]
+int main(int argc, char** argv)
+{
+	const size_t count = 50000000;
+
+	std::vector<double> magnitudes(count);
+	for(size_t i = 0; i < count; i++) magnitudes[i] = 0.1 * (double)(i % 1000);
+
+	const QuantityArray column(std::move(magnitudes), J);
+	const unsigned hardware = std::max(1u, std::thread::hardware_concurrency());
+	const unsigned maxThreads = (argc > 1 ? (unsigned)std::max(1, std::atoi(argv[1])) : hardware);
+
+	for(unsigned threads = 1; threads <= maxThreads; threads *= 2)
+	{
+		char name[64];
+
+		std::snprintf(name, sizeof(name), "deterministic sum, %u thread(s)", threads);
+		Bench::report(name, Bench::measure([&] { Bench::keep(Stats::parallel_sum(column, ReductionOptions(threads, 65536, true))); }), (double)count);
+
+		std::snprintf(name, sizeof(name), "fastest sum, %u thread(s)", threads);
+		Bench::report(name, Bench::measure([&] { Bench::keep(Stats::parallel_sum(column, ReductionOptions(threads, 65536, false))); }), (double)count);
+	}
+}
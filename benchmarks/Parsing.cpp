@@ -0,0 +1,167 @@
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "Units/Units.h"
+#include "Units/IO.h"
+#include "Units/Batch.h"
+#include "Units/ParseCache.h"
+#include "Units/Ucum.h"
+
+#include "Benchmark.h"
+
+using namespace Units;
+
+int main()
+{
+	const char* units[] = { "m", "kPa", "m/s", "m/s^2", "kWh", "mV", "Hz", "kg", u8"µm", u8"Ω", "N*m", "J/s", "mol", "dBm", "h" };
+	const size_t unitCount = sizeof(units) / sizeof(units[0]);
+	const size_t n = 200000;
+
+	std::vector<std::string> numbers, quantities;
+	numbers.reserve(n);
+	quantities.reserve(n);
+
+	for(size_t i = 0; i < n; i++)
+	{
+		const std::string number = (i % 3 == 0 ? std::to_string((int)(i % 10000)) : std::to_string(0.001 * (double)(i % 100000) - 12.5));
+		numbers.push_back(number);
+		quantities.push_back(number + " " + units[i % unitCount]);
+	}
+
+	Bench::report("strtod (numbers only)", Bench::measure([&] {
+		double total = 0.0;
+		for(const std::string& str : numbers) total += std::strtod(str.c_str(), nullptr);
+		Bench::keep(total);
+	}), (double)n);
+
+	Bench::report("to_unit", Bench::measure([&] {
+		for(size_t i = 0; i < n; i++) Bench::keep(to_unit(std::string(units[i % unitCount])));
+	}), (double)n);
+
+	// The same units as UCUM codes
+	const char* ucumCodes[] = { "m", "kPa", "m/s", "m/s2", "kW.h", "mV", "Hz", "kg", "um", "Ohm", "N.m", "J/s", "mol", "[psi]", "h" };
+
+	Bench::report("ucum_to_unit", Bench::measure([&] {
+		for(size_t i = 0; i < n; i++) Bench::keep(ucum_to_unit(std::string(ucumCodes[i % unitCount])));
+	}), (double)n);
+
+	std::vector<Unit> parsedUnits;
+	for(size_t i = 0; i < unitCount; i++) parsedUnits.push_back(to_unit(units[i]));
+
+	Bench::report("to_string(Unit)", Bench::measure([&] {
+		for(size_t i = 0; i < n; i++) Bench::keep(to_string(parsedUnits[i % unitCount]));
+	}), (double)n);
+
+	// More distinct units than the formatting cache holds, so most calls miss
+	Bench::report("to_string(Unit), misses", Bench::measure([&] {
+		for(size_t i = 0; i < n / 100; i++) Bench::keep(to_string(Unit((double)(i % 4096 + 1), kg * A)));
+	}), (double)(n / 100));
+
+	Bench::report("to_ucum", Bench::measure([&] {
+		for(size_t i = 0; i < n; i++) Bench::keep(to_ucum(parsedUnits[i % unitCount]));
+	}), (double)n);
+
+	Bench::report("to_quantity", Bench::measure([&] {
+		for(const std::string& str : quantities) Bench::keep(to_quantity(str));
+	}), (double)n);
+
+	std::string numberText, quantityText;
+	for(size_t i = 0; i < n; i++)
+	{
+		numberText += numbers[i] + (i % 8 == 7 ? "\n" : " ");
+		quantityText += quantities[i] + (i % 8 == 7 ? "\n" : " ");
+	}
+
+	Bench::report("istream >> double", Bench::measure([&] {
+		std::istringstream is(numberText);
+		double value, total = 0.0;
+		while(is >> value) total += value;
+		Bench::keep(total);
+	}), (double)n);
+
+	Bench::report("istream >> Quantity", Bench::measure([&] {
+		std::istringstream is(quantityText);
+		Quantity q;
+		for(size_t i = 0; i < n; i++)
+		{
+			// Unknown units (such as kWh) set the failbit but still consume their token
+			is >> q;
+			is.clear();
+			Bench::keep(q);
+		}
+	}), (double)n);
+
+	ParseCache cache;
+
+	Bench::report("ParseCache::to_unit", Bench::measure([&] {
+		for(size_t i = 0; i < n; i++) Bench::keep(cache.to_unit(std::string(units[i % unitCount])));
+	}), (double)n);
+
+	Bench::report("ParseCache::to_quantity", Bench::measure([&] {
+		for(const std::string& str : quantities) Bench::keep(cache.to_quantity(str));
+	}), (double)n);
+
+	// Vectors of 8 values with a shared unit
+	std::vector<std::string> lists;
+	for(size_t i = 0; i < n / 8; i++)
+	{
+		std::string list = "[";
+		for(size_t j = 0; j < 8; j++) list += numbers[8 * i + j] + (j == 7 ? "] " : ", ");
+		lists.push_back(list + units[i % unitCount]);
+	}
+
+	Bench::report("to_quantity per list element", Bench::measure([&] {
+		for(size_t i = 0; i < lists.size(); i++)
+			for(size_t j = 0; j < 8; j++) Bench::keep(to_quantity(numbers[8 * i + j] + " " + units[i % unitCount]));
+	}), (double)n);
+
+	Bench::report("parse_quantity_list", Bench::measure([&] {
+		QuantityArray values;
+		for(const std::string& list : lists)
+		{
+			parse_quantity_list(list.data(), list.data() + list.size(), values);
+			Bench::keep(values);
+		}
+	}), (double)n);
+
+	// Batches of independent strings, serial and on every hardware thread
+	std::vector<Quantity> batch;
+	std::vector<uint8_t> status;
+
+	Bench::report("parse_batch (1 thread)", Bench::measure([&] {
+		Bench::keep(parse_batch(quantities, batch, status));
+	}), (double)n);
+
+	Bench::report("parse_batch (all threads)", Bench::measure([&] {
+		Bench::keep(parse_batch(quantities, batch, status, BatchOptions(0)));
+	}), (double)n);
+
+	// Adversarial inputs: the time per byte must not grow with the length
+	for(size_t length = 1000; length <= 1000000; length *= 10)
+	{
+		const std::string inputs[][2] =
+		{
+			{ "nested parentheses", "1 " + std::string(length, '(') + "m" + std::string(length, ')') },
+			{ "unbalanced parentheses", "1 " + std::string(length, '(') },
+			{ "long product", "1 " + [&] { std::string str("m"); while(str.size() < length) str += "*m"; return str; }() },
+			{ "long number", "1." + std::string(length, '3') + " m" },
+			{ "long symbol", "1 " + std::string(length, 'k') + "m" },
+		};
+
+		for(const auto& input : inputs)
+		{
+			const std::string& str = input[1];
+			Quantity q;
+
+			const double ms = Bench::measure([&] {
+				Bench::keep(parse_quantity(str.data(), str.data() + str.size(), q, ParseLimits(SIZE_MAX)));
+			});
+
+			std::printf("worst case: %-24s %8zu bytes %10.3f ms %8.2f ns/byte\n", input[0].c_str(), str.size(), ms, 1e6 * ms / (double)str.size());
+		}
+	}
+}
@@ -0,0 +1,54 @@
+#include <thread>
+#include <vector>
+
+#include "Units/Units.h"
+#include "Units/QuantileSketch.h"
+
+#include "Benchmark.h"
+
+using namespace Units;
+
+int main()
+{
+	const size_t count = 5000000;
+	const Unit ms = Unit(milli, s);
+
+	std::vector<Quantity> latencies;
+	latencies.reserve(count);
+
+	for(size_t i = 0; i < count; i++)
+	{
+		const double value = (double)((i * 2654435761u) % 100000) / 100.0;
+		latencies.push_back(i % 4 == 0 ? Quantity(value / 1000.0, s) : Quantity(value, ms));
+	}
+
+	Bench::report("insert Quantity (mixed ms/s)", Bench::measure([&] {
+		QuantileSketch sketch;
+		for(const Quantity& q : latencies) sketch.insert(q);
+		Bench::keep(sketch.quantile(0.99));
+	}), (double)count);
+
+	Bench::report("insert double", Bench::measure([&] {
+		QuantileSketch sketch(ms);
+		for(const Quantity& q : latencies) sketch.insert(q.magnitude());
+		Bench::keep(sketch.quantile(0.99));
+	}), (double)count);
+
+	const unsigned threads = std::max(1u, std::thread::hardware_concurrency());
+
+	Bench::report("insert per thread + merge", Bench::measure([&] {
+		std::vector<QuantileSketch> sketches(threads, QuantileSketch(ms));
+		std::vector<std::thread> workers;
+
+		for(unsigned t = 0; t < threads; t++)
+			workers.emplace_back([&, t] {
+				for(size_t i = t; i < count; i += threads) sketches[t].insert(latencies[i]);
+			});
+
+		for(std::thread& w : workers) w.join();
+
+		QuantileSketch total(ms);
+		for(const QuantileSketch& sk : sketches) total.merge(sk);
+		Bench::keep(total.quantile(0.99));
+	}), (double)count);
+}
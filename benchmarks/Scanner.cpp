@@ -0,0 +1,39 @@
+#include <cstdio>
+#include <string>
+
+#include "Units/Units.h"
+#include "Units/Scanner.h"
+
+#include "Benchmark.h"
+
+using namespace Units;
+
+int main()
+{
+	const char* units[] = { "ms", "mV", "kPa", "us", "MHz" };
+	const size_t lines = 1000000;
+
+	std::string text;
+	for(size_t i = 0; i < lines; i++)
+	{
+		char line[128];
+		std::snprintf(line, sizeof(line), "2021-05-04T10:%02zu:%02zu INFO req=%zu latency=%.1f %s path=/api/v1/items\n",
+			(i / 60) % 60, i % 60, i, 0.1 * (double)(i % 1000), units[i % 5]);
+		text += line;
+	}
+
+	const std::string quiet(text.size(), 'x');
+
+	size_t found = 0;
+	double ms = Bench::measure([&] { found = scan_quantities(text.data(), text.data() + text.size()).size(); });
+	Bench::report("scan_quantities, log lines", ms, (double)lines);
+	std::printf("%-40s %10.3f GB/s, %zu quantities\n", "", (double)text.size() / ms / 1e6, found);
+
+	ms = Bench::measure([&] { found = scan_quantities(text.data(), text.data() + text.size(), ScanOptions({ "ms" })).size(); });
+	Bench::report("scan_quantities, whitelist", ms, (double)lines);
+	std::printf("%-40s %10.3f GB/s, %zu quantities\n", "", (double)text.size() / ms / 1e6, found);
+
+	ms = Bench::measure([&] { Bench::keep(scan_quantities(quiet.data(), quiet.data() + quiet.size())); });
+	Bench::report("scan_quantities, no digits", ms, (double)lines);
+	std::printf("%-40s %10.3f GB/s\n", "", (double)quiet.size() / ms / 1e6);
+}
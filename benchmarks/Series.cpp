@@ -0,0 +1,40 @@
+#include <vector>
+
+#include "Units/Units.h"
+#include "Units/QuantitySeries.h"
+
+#include "Benchmark.h"
+
+using namespace Units;
+
+int main()
+{
+	const size_t count = 10000000;
+
+	std::vector<double> time(count);
+	std::vector<double> power(count);
+
+	for(size_t i = 0; i < count; i++)
+	{
+		time[i]  = (double)i;
+		power[i] = 100.0 + (double)(i % 1000);
+	}
+
+	const QuantitySeries series(QuantityArray(time, s), QuantityArray(power, W));
+
+	Bench::report("derivative (10M samples)", Bench::measure([&] { Bench::keep(series.derivative()); }), (double)count);
+	Bench::report("cumulative_integral (10M samples)", Bench::measure([&] { Bench::keep(series.cumulative_integral()); }), (double)count);
+	Bench::report("integral (10M samples)", Bench::measure([&] { Bench::keep(series.integral()); }), (double)count);
+	Bench::report("resample 2.5 s (10M samples)", Bench::measure([&] { Bench::keep(series.resample(2.5 * s)); }), (double)count);
+
+	// Baseline: the same integral going through Quantity arithmetic
+	std::vector<Quantity> quantities(count);
+	for(size_t i = 0; i < count; i++) quantities[i] = power[i] * W;
+
+	Bench::report("integral via Quantity ops (10M samples)", Bench::measure([&] {
+		Quantity total = 0.0 * (W * s);
+		for(size_t i = 1; i < count; i++)
+			total += 0.5 * (quantities[i] + quantities[i - 1]) * ((time[i] - time[i - 1]) * s);
+		Bench::keep(total);
+	}), (double)count);
+}
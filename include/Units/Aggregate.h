@@ -0,0 +1,61 @@
+#pragma once
+
+#include <vector>
+
+#include "QuantityArray.h"
+
+namespace Units
+{
+	/**
+	 * @brief Aggregations over large amounts of quantities
+	 *
+	 * Units are resolved once per call: a @ref QuantityArray already shares
+	 * a single unit, and ranges of quantities are normalized to the unit of
+	 * their first element (converting only when the unit changes). Sums use
+	 * compensated (Neumaier) summation over independent lanes, so the results
+	 * are both fast and accurate even for millions of values.
+	 *
+	 * If a range contains quantities with incompatible dimensions, the result
+	 * is NaN with an error unit. Aggregations of empty ranges other than
+	 * @ref sum() return NaN.
+	 */
+	namespace Stats
+	{
+		/** @brief Sum of all the elements */
+		Quantity sum(const QuantityArray& values);
+		Quantity sum(const Quantity* first, const Quantity* last);
+		Quantity sum(const std::vector<Quantity>& values);
+
+		/** @brief Arithmetic mean of all the elements */
+		Quantity mean(const QuantityArray& values);
+		Quantity mean(const Quantity* first, const Quantity* last);
+		Quantity mean(const std::vector<Quantity>& values);
+
+		/** @brief Smallest element. NaN elements are ignored */
+		Quantity min(const QuantityArray& values);
+		Quantity min(const Quantity* first, const Quantity* last);
+		Quantity min(const std::vector<Quantity>& values);
+
+		/** @brief Largest element. NaN elements are ignored */
+		Quantity max(const QuantityArray& values);
+		Quantity max(const Quantity* first, const Quantity* last);
+		Quantity max(const std::vector<Quantity>& values);
+
+		/**
+		 * @brief Variance of all the elements
+		 *
+		 * The unit of the result is the square of the unit of the elements.
+		 *
+		 * @param sample  Whether to compute the sample variance (dividing by
+		 *                `n - 1`) instead of the population variance
+		 */
+		Quantity variance(const QuantityArray& values, bool sample = false);
+		Quantity variance(const Quantity* first, const Quantity* last, bool sample = false);
+		Quantity variance(const std::vector<Quantity>& values, bool sample = false);
+
+		/** @brief Standard deviation of all the elements */
+		Quantity stddev(const QuantityArray& values, bool sample = false);
+		Quantity stddev(const Quantity* first, const Quantity* last, bool sample = false);
+		Quantity stddev(const std::vector<Quantity>& values, bool sample = false);
+	}
+}
@@ -0,0 +1,60 @@
+#pragma once
+
+#include <cstddef>
+
+#include "QuantityArray.h"
+
+namespace Units
+{
+	/**
+	 * @name Element-wise arithmetic between quantity columns
+	 *
+	 * The unit of the result is computed once from the units of both columns,
+	 * so every element only costs a plain floating-point operation and the
+	 * loops can be vectorized by the compiler.
+	 *
+	 * Addition and subtraction accept columns with different (but compatible)
+	 * units: the right-hand side is converted to the unit of the left-hand
+	 * side on the fly. If the units are not compatible, or the columns have
+	 * different sizes, an empty array with an error unit is returned.
+	 * @{
+	 */
+	QuantityArray operator+(const QuantityArray& lhs, const QuantityArray& rhs);
+	QuantityArray operator-(const QuantityArray& lhs, const QuantityArray& rhs);
+	QuantityArray operator*(const QuantityArray& lhs, const QuantityArray& rhs);
+	QuantityArray operator/(const QuantityArray& lhs, const QuantityArray& rhs);
+
+	/**
+	 * @brief Multiply-add: `a * b + c`, element-wise
+	 *
+	 * Computed in a single pass without intermediate arrays. Whether the
+	 * multiplication and addition are contracted into a single rounding
+	 * depends on the target and compiler flags.
+	 *
+	 * @p c is converted to the unit of `a * b`. If its dimensions are not
+	 * compatible, or the columns have different sizes, an empty array with an
+	 * error unit is returned.
+	 */
+	QuantityArray fma(const QuantityArray& a, const QuantityArray& b, const QuantityArray& c);
+	/** @} */
+
+	/**
+	 * @name Element-wise arithmetic between ranges of quantities
+	 *
+	 * Every input range must share a single unit, which is checked once
+	 * before computing anything. Element `i` of the output is the result of
+	 * the operation between element `i` of every input, and @p out may alias
+	 * any of the inputs.
+	 *
+	 * @returns @cpp false @ce (leaving @p out untouched) if an input range
+	 * does not share a single unit or, for additions and subtractions, if
+	 * the units are not compatible
+	 * @{
+	 */
+	bool add     (const Quantity* first1, const Quantity* last1, const Quantity* first2, Quantity* out);
+	bool subtract(const Quantity* first1, const Quantity* last1, const Quantity* first2, Quantity* out);
+	bool multiply(const Quantity* first1, const Quantity* last1, const Quantity* first2, Quantity* out);
+	bool divide  (const Quantity* first1, const Quantity* last1, const Quantity* first2, Quantity* out);
+	bool fma     (const Quantity* first1, const Quantity* last1, const Quantity* first2, const Quantity* first3, Quantity* out);
+	/** @} */
+}
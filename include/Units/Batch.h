@@ -0,0 +1,79 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "IO.h"
+
+namespace Units
+{
+	/** @brief Outcome of parsing one string in @ref parse_batch() */
+	enum ParseStatus : uint8_t
+	{
+		PARSE_OK           = 0, ///< The string was parsed
+		PARSE_INVALID      = 1, ///< No number, or the unit could not be parsed
+		PARSE_OUT_OF_RANGE = 2, ///< The number does not fit in a @cpp double @ce
+		PARSE_TOO_LARGE    = 3  ///< The string exceeds the @ref ParseLimits
+	};
+
+	/** @brief Non-owning view of a UTF-8 string, like C++17's @cpp std::string_view @ce */
+	struct TextView
+	{
+		const char* data;
+		size_t size;
+	};
+
+	/** @brief Options for @ref parse_batch() */
+	struct BatchOptions
+	{
+		/** @brief Amount of worker threads. Zero uses the hardware concurrency */
+		unsigned threads;
+
+		/** @brief Amount of strings parsed by each task */
+		size_t chunk_size;
+
+		/** @brief Limits applied to every string */
+		ParseLimits limits;
+
+		BatchOptions(unsigned nthreads = 1, size_t chunk = 4096, const ParseLimits& lim = ParseLimits())
+			: threads(nthreads), chunk_size(chunk), limits(lim) {}
+	};
+
+	/**
+	 * @brief Parse many independent quantities at once
+	 *
+	 * Every string must contain exactly one quantity (surrounding whitespace
+	 * is allowed), which is parsed as @ref to_quantity() would. The strings
+	 * are split into chunks that may be parsed in parallel. Each task keeps
+	 * its own cache of unit suffixes, so every distinct unit is parsed once
+	 * per chunk and the numbers are read in place.
+	 *
+	 * Names are resolved against the unit registry as it was when the call
+	 * started, for every chunk: units registered by other threads meanwhile
+	 * are only seen by later calls.
+	 *
+	 * Strings that cannot be parsed get an error unit in @p out and a
+	 * non-zero status.
+	 *
+	 * @param inputs  Strings to parse
+	 * @param length  Amount of strings
+	 * @param out     Array of @p length quantities to fill
+	 * @param status  Array of @p length @ref ParseStatus values to fill, or
+	 *                @cpp nullptr @ce
+	 *
+	 * @returns the amount of strings that were parsed successfully
+	 */
+	size_t parse_batch(const TextView* inputs, size_t length, Quantity* out, uint8_t* status, const BatchOptions& options = BatchOptions());
+
+	/** @brief Parse many independent quantities at once, see @ref parse_batch() */
+	size_t parse_batch(const std::string* inputs, size_t length, Quantity* out, uint8_t* status, const BatchOptions& options = BatchOptions());
+
+	/**
+	 * @brief Parse many independent quantities at once, see @ref parse_batch()
+	 *
+	 * @p out and @p status are resized to the amount of inputs.
+	 */
+	size_t parse_batch(const std::vector<std::string>& inputs, std::vector<Quantity>& out, std::vector<uint8_t>& status, const BatchOptions& options = BatchOptions());
+}
@@ -0,0 +1,416 @@
+#pragma once
+
+/**
+ * @file
+ * @brief Built-in unit names, shared by the parser, the registry and the
+ * compile-time literals
+ *
+ * Every list is an X-macro: it calls the given macro once per entry, so each
+ * consumer builds its own table. The run-time parser, the registry and
+ * @ref Literals.h all expand it with the units of the catalog, which are
+ * @cpp constexpr @ce. Entries only use names of the catalog and the `*`, `/`
+ * and `^` operators, besides `gram__` and `root_Hz` below.
+ */
+
+#include "Units.h"
+
+namespace Units
+{
+	namespace details
+	{
+		/** @brief A thousandth of a kilogram, the unit of the name `g` */
+		constexpr Unit gram__ = Unit(0.001, kg);
+
+		/** @brief Square root of a hertz, as returned by `std::sqrt(Hz)` */
+		constexpr Unit root_Hz = Unit::from_data(1.0f, UnitData::from_exponents(0, 0, -1, 0, 0, 0, 0, 0, 0, 0, false, true, false));
+	}
+}
+
+/**
+ * @brief Symbols of the parser, looked up before any registry name
+ *
+ * Calls `SYMBOL(name, unit)` for every symbol. Every name must hash to a
+ * different value, see @ref Units::details::lookup_unit().
+ */
+#define UNITS_BUILTIN_SYMBOLS(SYMBOL) \
+	/* Special */ \
+	SYMBOL(u8"none" , none   ) \
+	SYMBOL(u8"%"    , percent) \
+	SYMBOL(u8"error", error  ) \
+	SYMBOL(u8"iflag", iflag  ) \
+	\
+	SYMBOL(u8""   , none) \
+	SYMBOL(u8"m"  , m   ) \
+	SYMBOL(u8"kg" , kg  ) \
+	SYMBOL(u8"s"  , s   ) \
+	SYMBOL(u8"A"  , A   ) \
+	SYMBOL(u8"K"  , K   ) \
+	SYMBOL(u8"mol", mol ) \
+	SYMBOL(u8"rad", rad ) \
+	SYMBOL(u8"Cd" , Cd  ) \
+	\
+	SYMBOL(u8"sr"      , sr      ) \
+	SYMBOL(u8"Hz"      , Hz      ) \
+	SYMBOL(u8"N"       , N       ) \
+	SYMBOL(u8"Pa"      , Pa      ) \
+	SYMBOL(u8"J"       , J       ) \
+	SYMBOL(u8"W"       , W       ) \
+	SYMBOL(u8"C"       , C       ) \
+	SYMBOL(u8"V"       , V       ) \
+	SYMBOL(u8"F"       , F       ) \
+	SYMBOL(u8"\u2126"  , ohm     ) \
+	SYMBOL(u8"S"       , S       ) \
+	SYMBOL(u8"Wb"      , Wb      ) \
+	SYMBOL(u8"T"       , T       ) \
+	SYMBOL(u8"H"       , H       ) \
+	SYMBOL(u8"lm"      , lm      ) \
+	SYMBOL(u8"lx"      , lx      ) \
+	SYMBOL(u8"Bq"      , Bq      ) \
+	SYMBOL(u8"Gy"      , Gy      ) \
+	SYMBOL(u8"Sv"      , Sv      ) \
+	SYMBOL(u8"kat"     , kat     ) \
+	SYMBOL(u8"$"       , currency) \
+	SYMBOL(u8"item"    , count   ) \
+	SYMBOL(u8"\u221AHz", root_Hz ) \
+	\
+	SYMBOL(u8"Np" , Log::neper) \
+	SYMBOL(u8"B"  , Log::B    ) \
+	SYMBOL(u8"BA" , Log::BA   ) \
+	SYMBOL(u8"dB" , Log::dB   ) \
+	SYMBOL(u8"dBA", Log::dBA  ) \
+	SYMBOL(u8"dBc", Log::dBc  ) \
+	\
+	SYMBOL(u8"BV"       , Log::BV    ) \
+	SYMBOL(u8"BmV"      , Log::BmV   ) \
+	SYMBOL(u8"B\u00B5V" , Log::BuV   ) \
+	SYMBOL(u8"B\u03BCV" , Log::BuV   ) \
+	SYMBOL(u8"BuV"      , Log::BuV   ) \
+	SYMBOL(u8"B10nV"    , Log::B10nV ) \
+	SYMBOL(u8"BW"       , Log::BW    ) \
+	SYMBOL(u8"Bk"       , Log::Bk    ) \
+	SYMBOL(u8"dBV"      , Log::dBV   ) \
+	SYMBOL(u8"dBmV"     , Log::dBmV  ) \
+	SYMBOL(u8"dB\u00B5V", Log::dBuV  ) \
+	SYMBOL(u8"dB\u03BCV", Log::dBuV  ) \
+	SYMBOL(u8"dBuV"     , Log::dBuV  ) \
+	SYMBOL(u8"dB10nV"   , Log::dB10nV) \
+	SYMBOL(u8"dBW"      , Log::dBW   ) \
+	SYMBOL(u8"dBk"      , Log::dBk   ) \
+	SYMBOL(u8"dBm"      , Log::dBm   ) \
+	\
+	SYMBOL(u8"h" , Time::hour     ) \
+	SYMBOL(u8"Eh", Energy::hartree) \
+	SYMBOL(u8"mi", i::mile)
+
+/**
+ * @brief Names the registry starts out with
+ *
+ * Calls `NAME(unit, name)` for every name. When a unit has several names, the
+ * first one is used for formatting, and when a name stands for several units,
+ * the first one is used for parsing.
+ */
+#define UNITS_BUILTIN_NAMES(NAME) \
+	/* Base SI units */ \
+	NAME(none  , u8""       ) \
+	NAME(m     , u8"m"      ) \
+	NAME(m^2   , u8"m\u00B2") \
+	NAME(m^3   , u8"m\u00B3") \
+	NAME(kg    , u8"kg"     ) \
+	NAME(s     , u8"s"      ) \
+	NAME(A     , u8"A"      ) \
+	NAME(K     , u8"K"      ) \
+	NAME(mol   , u8"mol"    ) \
+	NAME(rad   , u8"rad"    ) \
+	NAME(Cd    , u8"Cd"     ) \
+	NAME(gram__, u8"g"      ) \
+	\
+	/* Derived SI units */ \
+	NAME(sr      , u8"sr"      ) \
+	NAME(Hz      , u8"Hz"      ) \
+	NAME(N       , u8"N"       ) \
+	NAME(Pa      , u8"Pa"      ) \
+	NAME(J       , u8"J"       ) \
+	NAME(W       , u8"W"       ) \
+	NAME(C       , u8"C"       ) \
+	NAME(V       , u8"V"       ) \
+	NAME(F       , u8"F"       ) \
+	NAME(ohm     , u8"\u2126"  ) \
+	NAME(S       , u8"S"       ) \
+	NAME(Wb      , u8"Wb"      ) \
+	NAME(T       , u8"T"       ) \
+	NAME(H       , u8"H"       ) \
+	NAME(lm      , u8"lm"      ) \
+	NAME(lx      , u8"lx"      ) \
+	NAME(Bq      , u8"Bq"      ) \
+	NAME(Gy      , u8"Gy"      ) \
+	NAME(Sv      , u8"Sv"      ) \
+	NAME(kat     , u8"kat"     ) \
+	NAME(rad * W , u8"W"       ) \
+	NAME(currency, u8"$"       ) \
+	NAME(count   , u8"count"   ) \
+	NAME(root_Hz , u8"\u221AHz") \
+	\
+	NAME(ft, u8"ft") \
+	\
+	/* CGS */ \
+	NAME(CGS::erg         , u8"erg") \
+	NAME(CGS::dyn         , u8"dyn") \
+	NAME(CGS::barye       , u8"Ba" ) \
+	NAME(CGS::gal         , u8"Gal") \
+	NAME(CGS::poise       , u8"P"  ) \
+	NAME(CGS::stokes      , u8"St" ) \
+	NAME(CGS::kayser      , u8"K"  ) /* cm^-1 */ \
+	NAME(CGS::oersted     , u8"Oe" ) \
+	NAME(CGS::gauss       , u8"G"  ) \
+	NAME(CGS::debye       , u8"D"  ) \
+	NAME(CGS::maxwell     , u8"Mx" ) \
+	NAME(CGS::biot        , u8"Bi" ) \
+	NAME(CGS::gilbert     , u8"Gb" ) \
+	NAME(CGS::stilb       , u8"sb" ) \
+	NAME(CGS::lambert     , u8"Lb" ) \
+	NAME(CGS::phot        , u8"ph" ) \
+	NAME(CGS::curie       , u8"Ci" ) \
+	NAME(CGS::roentgen    , u8"R"  ) \
+	NAME(CGS::REM         , u8"rem") \
+	NAME(CGS::RAD         , u8"rad") \
+	NAME(CGS::emu         , u8""   ) \
+	NAME(CGS::langley     , u8""   ) \
+	NAME(CGS::unitpole    , u8""   ) \
+	NAME(CGS::statC_charge, u8""   ) \
+	NAME(CGS::statC_flux  , u8""   ) \
+	\
+	/* GM */ \
+	NAME(GM::pond    , u8"gf" ) \
+	NAME(GM::hyl     , u8"hyl") \
+	NAME(GM::at      , u8"at" ) \
+	NAME(GM::poncelet, u8"p"  ) \
+	NAME(GM::PS      , u8"PS" ) \
+	\
+	/* MTS */ \
+	NAME(MTS::sthene , u8"sn") \
+	NAME(MTS::pieze  , u8"pz") \
+	NAME(MTS::thermie, u8"th") \
+	\
+	/* Time */ \
+	NAME(Time::min , u8"min" ) \
+	NAME(Time::hour, u8"h"   ) \
+	NAME(Time::day , u8"d"   ) \
+	NAME(Time::week, u8"w"   ) \
+	NAME(Time::year, u8"year") \
+	\
+	/* International */ \
+	NAME(i::grain     , u8"gr"   ) \
+	NAME(i::inch      , u8"in"   ) \
+	NAME(i::foot      , u8"ft"   ) \
+	NAME(i::yard      , u8"yd"   ) \
+	NAME(i::mile      , u8"mi"   ) \
+	NAME(i::league    , u8"lea"  ) \
+	NAME(i::cord      , u8"cd-ft") \
+	NAME(i::board_foot, u8"BDFT" ) \
+	NAME(i::mil       , u8"mil"  ) \
+	NAME(i::circ_mil  , u8"cmil" ) \
+	\
+	/* Avoirdupois */ \
+	NAME(av::dram             , u8"dr"   ) \
+	NAME(av::ounce            , u8"oz"   ) \
+	NAME(av::pound            , u8"lb"   ) \
+	NAME(av::hundredweight    , u8"cwt"  ) \
+	NAME(av::longhundredweight, u8"cwt"  ) \
+	NAME(av::ton              , u8"t"    ) \
+	NAME(av::longton          , u8"l. tn") \
+	NAME(av::stone            , u8"st"   ) \
+	NAME(av::poundal          , u8"pdl"  ) \
+	NAME(av::lbf              , u8"lbf"  ) \
+	NAME(av::ozf              , u8"ozf"  ) \
+	NAME(av::slug             , u8"slug" ) \
+	\
+	/* Troy */ \
+	NAME(Troy::pennyweight, u8"dwt" ) \
+	NAME(Troy::oz         , u8"oz t") \
+	NAME(Troy::pound      , u8"lb t") \
+	\
+	/* US */ \
+	\
+	/* Metric */ \
+	NAME(Metric::tbsp       , u8"tbsp" ) \
+	NAME(Metric::tsp        , u8"tsp"  ) \
+	NAME(Metric::floz       , u8"fl oz") /* Review: fl. Oz. is better? */ \
+	NAME(Metric::cup        , u8"cup"  ) \
+	NAME(Metric::cup_uslegal, u8"cup"  ) \
+	NAME(Metric::carat      , u8"ct"   ) \
+	\
+	/* Canada */ \
+	NAME(Canada::tbsp              , u8"tbsp") \
+	NAME(Canada::tsp               , u8"tsp" ) \
+	NAME(Canada::cup               , u8"cup" ) \
+	NAME(Canada::cup_trad          , u8"cup" ) \
+	NAME(Canada::Grain::bushel_oats, u8"bu"  ) \
+	\
+	/* Australia */ \
+	NAME(Australia::tbsp, u8"tbsp") \
+	NAME(Australia::tsp , u8"tsp" ) \
+	NAME(Australia::cup , u8"cup" ) \
+	\
+	/* Imperial */ \
+	/* Apothecaries */ \
+	/* Nautical */ \
+	/* Japan */ \
+	\
+	/* Chinese */ \
+	NAME(Chinese::jin  , u8"\u65A4") \
+	NAME(Chinese::liang, u8"\u4E24") \
+	NAME(Chinese::qian , u8"\u9322") \
+	NAME(Chinese::li   , u8"\u91CC") \
+	NAME(Chinese::cun  , u8"\u5BF8") \
+	NAME(Chinese::chi  , u8"\u5C3A") \
+	NAME(Chinese::zhang, u8"\u4E08") \
+	\
+	/* Typografic */ \
+	\
+	/* Distance */ \
+	NAME(Distance::ly       , u8"ly"    ) \
+	NAME(Distance::au       , u8"AU"    ) \
+	NAME(Distance::au_old   , u8"AU"    ) \
+	NAME(Distance::angstrom , u8"\u212B") \
+	NAME(Distance::parsec   , u8"pc"    ) \
+	NAME(Distance::arpent_us, u8"arpent") \
+	NAME(Distance::arpent_fr, u8"arpent") \
+	NAME(Distance::xu       , u8"xu"    ) \
+	\
+	/* Area */ \
+	NAME(Area::are    , u8"a" ) \
+	NAME(Area::hectare, u8"ha") \
+	NAME(Area::barn   , u8"b" ) \
+	\
+	/* Angle */ \
+	NAME(Angle::deg   , u8"\u00B0") \
+	NAME(Angle::grad  , u8"grad"  ) \
+	NAME(Angle::brad  , u8"brad"  ) \
+	NAME(Angle::gon   , u8"gon"   ) \
+	NAME(Angle::arcmin, u8"'"     ) \
+	NAME(Angle::arcsec, u8"\""    ) \
+	\
+	/* Temperature */ \
+	NAME(Temperature::degC , u8"\u00B0C" ) \
+	NAME(Temperature::degF , u8"\u00B0F" ) \
+	NAME(Temperature::degR , u8"\u00B0R" ) \
+	NAME(Temperature::degRe, u8"\u00B0Re") \
+	\
+	/* Pressure */ \
+	NAME(Pressure::bar  , u8"bar"         ) \
+	NAME(Pressure::psi  , u8"lbf/in\u00B2") \
+	NAME(Pressure::inHg , u8"inHg"        ) \
+	NAME(Pressure::mmHg , u8"mmHg"        ) \
+	NAME(Pressure::torr , u8"torr"        ) \
+	NAME(Pressure::inH2O, u8"inH\u2082O"  ) \
+	NAME(Pressure::mmH2O, u8"mmH\u2082O"  ) \
+	NAME(Pressure::atm  , u8"atm"         ) \
+	\
+	/* Power */ \
+	NAME(Power::hpE, u8"hp(E)") \
+	NAME(Power::hpI, u8"hp(I)") \
+	NAME(Power::hpS, u8"hp(S)") \
+	NAME(Power::hpM, u8"hp(M)") \
+	/* NAME(Power::VA, u8"VA") */ \
+	NAME(Power::VAR, u8"VAR") \
+	\
+	/* Energy */ \
+	NAME(Energy::Wh      , u8"Wh"             ) \
+	NAME(Energy::eV      , u8"eV"             ) \
+	NAME(Energy::cal_4   , u8"cal [4\u00B0C]" ) \
+	NAME(Energy::cal_15  , u8"cal [15\u00B0C]") \
+	NAME(Energy::cal_20  , u8"cal [20\u00B0C]") \
+	NAME(Energy::cal_mean, u8"cal"            ) \
+	NAME(Energy::cal_it  , u8"cal"            ) \
+	NAME(Energy::cal_th  , u8"cal"            ) \
+	NAME(Energy::btu_th  , u8"BTU"            ) \
+	NAME(Energy::btu_39  , u8"BTU [39\u00B0F]") \
+	NAME(Energy::btu_59  , u8"BTU [59\u00B0F]") \
+	NAME(Energy::btu_60  , u8"BTU [60\u00B0F]") \
+	NAME(Energy::btu_mean, u8"BTU"            ) \
+	NAME(Energy::btu_it  , u8"BTU"            ) \
+	NAME(Energy::btu_iso , u8"ISO BTU"        ) \
+	NAME(Energy::quad    , u8"Quad"           ) \
+	NAME(Energy::therm_us, u8"Therm [US]"     ) \
+	NAME(Energy::therm_br, u8"Therm [GB]"     ) \
+	NAME(Energy::therm_ec, u8"Therm [ISO]"    ) \
+	NAME(Energy::ton_tnt , u8"t"              ) \
+	NAME(Energy::boe     , u8"BOE"            ) \
+	NAME(Energy::foeb    , u8"FOEB"           ) \
+	NAME(Energy::hartree , u8"E\u2095"        ) \
+	NAME(Energy::tonhour , u8"ton\u2219h"     ) \
+	\
+	/* Textile */ \
+	NAME(Textile::tex   , u8"tex"   ) \
+	NAME(Textile::denier, u8"den"   ) \
+	NAME(Textile::span  , u8"span"  ) /* Review */ \
+	NAME(Textile::finger, u8"finger") /* Review */ \
+	NAME(Textile::nail  , u8"nail"  ) /* Review */ \
+	\
+	/* Clinical */ \
+	NAME(Clinical::pru          , u8"PRU"   ) \
+	NAME(Clinical::woodu        , u8"WU"    ) \
+	NAME(Clinical::diopter      , u8"dpt"   ) \
+	NAME(Clinical::prism_diopter, u8"\u0394") \
+	NAME(Clinical::mesh         , u8"mesh"  ) \
+	NAME(Clinical::charriere    , u8"Fr"    ) \
+	NAME(Clinical::drop         , u8"gt"    ) \
+	NAME(Clinical::met          , u8"MET"   ) \
+	\
+	/* Log */ \
+	NAME(Log::neper   , u8"Np"      ) \
+	NAME(Log::B       , u8"B"       ) \
+	NAME(Log::BA      , u8"BA"      ) \
+	NAME(Log::dB      , u8"dB"      ) \
+	NAME(Log::dBA     , u8"dBA"     ) \
+	NAME(Log::dBc     , u8"dBc"     ) \
+	NAME(Log::log2    , u8"log2"    ) \
+	NAME(Log::log10   , u8"log10"   ) \
+	NAME(Log::neglog10, u8"-log10"  ) \
+	NAME(Log::B_SPL   , u8"B SPL"   ) \
+	NAME(Log::dB_SPL  , u8"dB SPL"  ) \
+	NAME(Log::BV      , u8"BV"      ) \
+	NAME(Log::BmV     , u8"BmV"     ) \
+	NAME(Log::Bu      , u8"B\u00B5" ) \
+	NAME(Log::BuV     , u8"B\u00B5V") \
+	NAME(Log::B10nV   , u8"B10nV"   ) \
+	NAME(Log::BW      , u8"BW"      ) \
+	NAME(Log::Bk      , u8"Bk"      ) \
+	NAME(Log::dBV     , u8"dBV"     ) \
+	NAME(Log::dBmV    , u8"dBmV"    ) \
+	NAME(Log::dBuV    , u8"dBuV"    ) \
+	NAME(Log::dB10nV  , u8"dB10nV"  ) \
+	NAME(Log::dBW     , u8"dBW"     ) \
+	NAME(Log::dBk     , u8"dBk"     ) \
+	NAME(Log::dBm     , u8"dBm"     ) \
+	NAME(Log::dBu     , u8"dB\u00B5") \
+	\
+	/* Laboratory */ \
+	NAME(Laboratory::svedberg, u8"S"  ) \
+	NAME(Laboratory::PFU     , u8"PFU") \
+	NAME(Laboratory::pH      , u8"pH" ) \
+	\
+	/* Data */ \
+	NAME(Data::bit   , u8"b"     ) \
+	NAME(Data::nibble, u8"nibble") \
+	NAME(Data::byte  , u8"B"     ) \
+	\
+	/* Computation */ \
+	NAME(Computation::FLOP , u8"FLOP" ) \
+	NAME(Computation::FLOPS, u8"FLOPS") \
+	NAME(Computation::MIPS , u8"MIPS" ) \
+	\
+	/* Concentrations */ \
+	NAME(percent  , u8"%"     ) \
+	NAME(per_mille, u8"\u2030") \
+	NAME(bp       , u8"\u2031") \
+	NAME(ppm      , u8"ppm"   ) \
+	NAME(ppb      , u8"ppb"   ) \
+	\
+	/* Misc */ \
+	NAME(L  , u8"L"  ) \
+	NAME(Da , u8"u"  ) \
+	NAME(rpm, u8"rpm") \
+	\
+	NAME(J / (kg * K), u8"J/(kg\u2219K)") \
+	NAME(W / (m * K) , u8"W/(m\u2219K)")
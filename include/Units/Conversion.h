@@ -0,0 +1,63 @@
+#pragma once
+
+#include "Unit.h"
+
+namespace Units
+{
+	/**
+	 * @brief Precomputed conversion between two units of the same dimensions
+	 *
+	 * Every conversion supported by this library is affine (a scale plus an
+	 * offset, the latter only being non-zero for the Fahrenheit and Réaumur
+	 * temperature scales). Any other scale of kelvin, such as `mK`, is
+	 * linear; Celsius is the same unit as kelvin, so it is converted as
+	 * kelvin. This type
+	 * resolves both terms once so that large amounts of magnitudes can be
+	 * converted with a single multiply-add each, instead of going through
+	 * @ref Units::convert() for every value.
+	 */
+	class Conversion
+	{
+	private:
+		double m_Scale;
+		double m_Offset;
+		bool m_Valid;
+		bool m_Identity;
+
+	public:
+		/** @brief Constructor. Creates an identity conversion */
+		constexpr Conversion()
+			: m_Scale(1.0), m_Offset(0.0), m_Valid(true), m_Identity(true) {}
+
+		/**
+		 * @brief Constructor. Resolves the conversion from one unit to another
+		 *
+		 * If both units do not share the same base units (or
+		 * @ref Units::convert() cannot convert between them), the conversion
+		 * is marked as invalid and every converted value will be NaN.
+		 */
+		Conversion(const Unit& from, const Unit& to);
+
+		/** @brief Returns whether both units were compatible */
+		bool valid() const { return m_Valid; }
+
+		/** @brief Get the scale term of this conversion */
+		double scale() const { return m_Scale; }
+
+		/** @brief Get the offset term of this conversion */
+		double offset() const { return m_Offset; }
+
+		/** @brief Returns whether this conversion leaves values untouched */
+		bool identity() const { return m_Identity; }
+
+		/** @brief Converts a single magnitude */
+		double operator()(double value) const { return value * m_Scale + m_Offset; }
+
+		/**
+		 * @brief Converts a contiguous range of magnitudes
+		 *
+		 * @p out may alias @p first to convert in place.
+		 */
+		void apply(const double* first, const double* last, double* out) const;
+	};
+}
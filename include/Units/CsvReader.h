@@ -0,0 +1,141 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "QuantityArray.h"
+
+namespace Units
+{
+	/** @brief Options for @ref CsvReader */
+	struct CsvOptions
+	{
+		/** @brief Character that separates the cells of a row */
+		char delimiter;
+
+		CsvOptions(char delim = ',') : delimiter(delim) {}
+	};
+
+	/** @brief Column of a CSV file, with the unit declared in its header */
+	struct CsvColumn
+	{
+		/** @brief Header of the column, without its unit */
+		std::string name;
+
+		/** @brief Values of the column, in the unit of the header */
+		QuantityArray values;
+	};
+
+	/** @brief Cell that could not be parsed */
+	struct CsvError
+	{
+		/** @brief Index of the row in the columns, starting at 0 */
+		size_t row;
+
+		/** @brief Index of the column */
+		size_t column;
+	};
+
+	/**
+	 * @brief Streaming CSV reader for columns of quantities
+	 *
+	 * The first row is a header that declares the unit of each column once,
+	 * between brackets or parentheses (`temperature [K]`, `flow [L/min]`,
+	 * `energy (kWh)`). Headers without a unit declare dimensionless columns.
+	 * The units are parsed once, and the cells are then parsed as plain
+	 * numbers straight into the @ref QuantityArray of their column.
+	 *
+	 * A cell may override the unit of its column (`300 K` in a column of
+	 * `mK`): it is parsed with the usual grammar and converted to the unit
+	 * of the column. Every distinct override is parsed only once.
+	 *
+	 * Celsius is the same unit as kelvin in this library, so values in `°C`
+	 * (in a header or in a cell) are stored as kelvin: 273.15 is added to
+	 * them, and a `temperature [°C]` column holds kelvin. Other temperature
+	 * scales keep their own unit, and convert to kelvin with their offset.
+	 *
+	 * Bytes are fed in arbitrary chunks, as in @ref IncrementalParser, and
+	 * each row is parsed as soon as it is complete. Cells may be quoted as
+	 * in RFC 4180, and rows may end in `\n` or `\r\n`. Blank rows are
+	 * skipped. Empty cells are stored as NaN; cells that cannot be parsed
+	 * or converted (and missing cells) are stored as NaN and reported as
+	 * errors. Cells beyond the last column are reported as errors too.
+	 *
+	 * To read a file of unbounded size, process the columns periodically
+	 * and call @ref clear() to release the rows read so far.
+	 */
+	class CsvReader
+	{
+	private:
+		// Unit override already seen in a cell
+		struct Override
+		{
+			std::string suffix;
+			Quantity term;
+			double offset;
+		};
+
+		char m_Delimiter;
+		bool m_HasHeader;
+		bool m_Quoted;
+		size_t m_Rows;
+
+		std::vector<CsvColumn> m_Columns;
+		std::vector<bool> m_ValidUnits;
+		std::vector<double> m_Offsets;
+		std::vector<CsvError> m_Errors;
+
+		std::string m_Partial;
+		std::string m_Field;
+
+		std::vector<Override> m_Overrides;
+		std::unordered_map<uint32_t, size_t> m_OverrideIndex;
+
+		const char* unquote(const char* first, const char* last);
+		void header(const char* first, const char* last);
+		void row(const char* first, const char* last);
+		void cell(size_t column, const char* first, const char* last);
+		double convert(size_t column, double value, const char* first, const char* last);
+
+	public:
+		/** @brief Constructor. Creates a reader that still expects the header */
+		explicit CsvReader(const CsvOptions& options = CsvOptions());
+
+		/**
+		 * @brief Feed a chunk of UTF-8 bytes
+		 *
+		 * @returns the amount of rows completed by this chunk
+		 */
+		size_t feed(const char* data, size_t length);
+
+		/** @brief Feed a chunk of UTF-8 bytes */
+		size_t feed(const std::string& data) { return feed(data.data(), data.size()); }
+
+		/**
+		 * @brief Signal the end of the input
+		 *
+		 * Parses the last row if the input did not end with a newline.
+		 *
+		 * @returns the amount of rows completed (zero or one)
+		 */
+		size_t finish();
+
+		/** @brief Returns whether the header has been read */
+		bool has_header() const { return m_HasHeader; }
+
+		/** @brief Get the columns declared in the header, with the rows read so far */
+		const std::vector<CsvColumn>& columns() const { return m_Columns; }
+
+		/** @brief Get the amount of rows read since the last call to @ref clear() */
+		size_t rows() const { return m_Rows; }
+
+		/** @brief Get the cells that could not be parsed since the last call to @ref clear() */
+		const std::vector<CsvError>& errors() const { return m_Errors; }
+
+		/** @brief Remove the rows and errors read so far. The header is kept */
+		void clear();
+	};
+}
@@ -0,0 +1,116 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include "QuantityArray.h"
+
+namespace Units
+{
+	/** @brief Comparison operators supported by @ref Filter */
+	enum class Comparison
+	{
+		Less,
+		LessEqual,
+		Greater,
+		GreaterEqual,
+		Equal,
+		NotEqual
+	};
+
+	/**
+	 * @brief Tolerance used when comparing magnitudes against a threshold
+	 *
+	 * The effective tolerance of a comparison is the largest of the absolute
+	 * tolerance (expressed in the unit of the threshold) and the relative
+	 * tolerance times the magnitude of the threshold. Two values are equal
+	 * if they are within the tolerance of each other, and strict comparisons
+	 * (`<`, `>`) only hold if values are further apart than the tolerance.
+	 */
+	struct Tolerance
+	{
+		double absolute;
+		double relative;
+
+		constexpr Tolerance(double abs = 0.0, double rel = 0.0)
+			: absolute(abs), relative(rel) {}
+
+		/** @brief Returns a tolerance that compares magnitudes exactly */
+		static constexpr Tolerance exact() { return Tolerance(); }
+
+		/**
+		 * @brief Returns a tolerance similar to the one of @ref Quantity comparisons
+		 *
+		 * Quantity comparison operators round both magnitudes to 15 decimal
+		 * places before comparing them, which is roughly equivalent to an
+		 * absolute tolerance of half a unit in the 15th decimal place.
+		 */
+		static constexpr Tolerance quantity() { return Tolerance(0.5e-15); }
+	};
+
+	/**
+	 * @brief Vectorized filter over a column of magnitudes
+	 *
+	 * Each predicate threshold is converted into the unit of the column once
+	 * when the predicate is added, so evaluating the filter only compares raw
+	 * magnitudes. Chained predicates are combined with a logical AND, and all
+	 * the range predicates (`<`, `<=`, `>`, `>=`, `==`) are folded into a
+	 * single interval, so the column is traversed once regardless of how many
+	 * of them are chained.
+	 *
+	 * NaN magnitudes never match. If a threshold has dimensions incompatible
+	 * with the column, the filter matches nothing.
+	 *
+	 * The column is not copied, so it must outlive the filter.
+	 */
+	class Filter
+	{
+	private:
+		const double* m_Data;
+		size_t m_Size;
+		Unit m_Unit;
+		Tolerance m_Tolerance;
+
+		double m_Lower;
+		double m_Upper;
+		bool m_LowerInclusive;
+		bool m_UpperInclusive;
+		bool m_Empty;
+
+		std::vector<std::pair<double, double>> m_Excluded;
+
+		void restrictLower(double value, bool inclusive);
+		void restrictUpper(double value, bool inclusive);
+
+	public:
+		/** @brief Constructor. Creates a filter over a column */
+		explicit Filter(const QuantityArray& column, Tolerance tolerance = Tolerance::exact());
+
+		/** @brief Constructor. Creates a filter over raw magnitudes of the given unit */
+		Filter(const double* data, size_t size, Unit un, Tolerance tolerance = Tolerance::exact());
+
+		/** @brief Adds a predicate comparing the column against a threshold */
+		Filter& where(Comparison op, const Quantity& threshold);
+
+		/** @brief Adds an inclusive range predicate, equivalent to `>= low` and `<= high` */
+		Filter& between(const Quantity& low, const Quantity& high);
+
+		/** @brief Get the number of elements of the column */
+		size_t size() const { return m_Size; }
+
+		/**
+		 * @brief Evaluate the filter as a bitmask
+		 *
+		 * Bit `i % 64` of word `i / 64` is set if element `i` matches.
+		 */
+		std::vector<uint64_t> mask() const;
+
+		/** @brief Evaluate the filter as a selection vector of matching indices */
+		std::vector<size_t> select() const;
+
+		/** @brief Count the number of matching elements */
+		size_t count() const;
+	};
+}
@@ -1,9 +1,13 @@
 #pragma once
 
+#include <cstddef>
+#include <cstdint>
 #include <ostream>
 #include <string>
+#include <system_error>
 
 #include "Units.h"
+#include "QuantityArray.h"
 
 namespace Units
 {
@@ -95,10 +99,119 @@ namespace Units
 	 * or the given string is invalid, @cpp Units::error @ce is returned
 	 */
 	Quantity to_quantity(std::istream& is);
+
+	/**
+	 * @brief Limits for parsing untrusted input
+	 *
+	 * Parsing always takes linear time and never recurses, whatever the
+	 * input. These limits additionally bound the size of the input and the
+	 * memory used for nested parentheses (the first 32 levels never touch
+	 * the heap).
+	 */
+	struct ParseLimits
+	{
+		/** @brief Maximum nesting of parentheses */
+		size_t max_depth;
+
+		/** @brief Maximum length of the input, in bytes */
+		size_t max_length;
+
+		ParseLimits(size_t depth = 256, size_t length = SIZE_MAX)
+			: max_depth(depth), max_length(length) {}
+	};
+
+	/** @brief Result of @ref parse_quantity() and @ref parse_unit() */
+	struct ParseResult
+	{
+		/**
+		 * @brief Where parsing stopped
+		 *
+		 * On success, points past the last consumed character. On failure,
+		 * points to the character (or symbol) that could not be parsed.
+		 */
+		const char* ptr;
+
+		/** @brief @cpp std::errc() @ce on success, or the reason of the failure */
+		std::errc ec;
+	};
+
+	/**
+	 * @brief Parse a quantity from a range of UTF-8 bytes
+	 *
+	 * Works like @cpp std::from_chars() @ce: parsing stops at the first
+	 * character that is not part of the quantity, and @p out is only
+	 * assigned on success. Leading whitespace is skipped.
+	 *
+	 * Fails with @cpp std::errc::invalid_argument @ce if there is no number
+	 * or the unit cannot be parsed, and with
+	 * @cpp std::errc::result_out_of_range @ce if the number does not fit in a
+	 * @cpp double @ce.
+	 *
+	 * Fails with @cpp std::errc::value_too_large @ce if the input exceeds
+	 * the given limits. The default limits allow 256 nested parentheses and
+	 * inputs of any length; the same defaults apply to @ref to_quantity()
+	 * and @ref to_unit(), which return an error unit instead. The heap is
+	 * only used for more than 32 nested parentheses.
+	 */
+	ParseResult parse_quantity(const char* first, const char* last, Quantity& out, const ParseLimits& limits = ParseLimits());
+
+	/**
+	 * @brief Parse a unit from a range of UTF-8 bytes
+	 *
+	 * Works like @ref parse_quantity(), without the leading number. Fails
+	 * with @cpp std::errc::invalid_argument @ce if there is no unit or it
+	 * cannot be parsed, and with @cpp std::errc::value_too_large @ce if the
+	 * input exceeds the given limits.
+	 */
+	ParseResult parse_unit(const char* first, const char* last, Unit& out, const ParseLimits& limits = ParseLimits());
+
+	/**
+	 * @brief Parse a list of numbers that share a unit
+	 *
+	 * Accepts a bracketed list (`[1.2, 3.4, 5.6] km/h`) or numbers separated
+	 * by whitespace (`1.2 3.4 5.6 mV`), followed by a single unit. The unit
+	 * is parsed once, and the magnitudes are stored contiguously as
+	 * @ref to_quantity() would convert each element (so `km/h` becomes a
+	 * factor of 1000 on `m/h`). A missing unit means a dimensionless list.
+	 *
+	 * Works like @ref parse_quantity(): @p out is only assigned on success,
+	 * and parsing stops at the first character that is not part of the
+	 * list. Fails with @cpp std::errc::invalid_argument @ce if the list or
+	 * its unit cannot be parsed, with @cpp std::errc::result_out_of_range @ce
+	 * if a number does not fit in a @cpp double @ce, and with
+	 * @cpp std::errc::value_too_large @ce if the input exceeds the given
+	 * limits.
+	 */
+	ParseResult parse_quantity_list(const char* first, const char* last, QuantityArray& out, const ParseLimits& limits = ParseLimits());
+
+	/**
+	 * @brief Convert a UTF-8 list of numbers that share a unit to an array
+	 *
+	 * See @ref parse_quantity_list(). If the list cannot be parsed, an empty
+	 * array with an error unit is returned.
+	 */
+	QuantityArray to_quantity_array(const std::string& str);
 }
 
 inline std::ostream& operator<<(std::ostream& os, const Units::Quantity& q) { return os << Units::to_string(q); }
 inline std::ostream& operator<<(std::ostream& os, const Units::Unit& u)     { return os << Units::to_string(u); }
 
-inline std::istream& operator>>(std::istream& is, Units::Quantity& q) { q = Units::to_quantity(is); return is; }
-inline std::istream& operator>>(std::istream& is, Units::Unit& u)     { u = Units::to_unit    (is); return is; }
+/**
+ * @brief Extract a quantity from a stream
+ *
+ * Reads only the characters that make up the quantity (for example,
+ * `9.81 m/s^2`) straight from the stream buffer, so several quantities can
+ * be read from the same line. The stream is left positioned after the
+ * quantity and any spaces that follow it. If no valid quantity can be read,
+ * the failbit is set.
+ */
+std::istream& operator>>(std::istream& is, Units::Quantity& q);
+
+/**
+ * @brief Extract a unit from a stream
+ *
+ * Reads only the characters that make up the unit, like the quantity
+ * extraction operator does. If no valid unit can be read, the failbit is
+ * set.
+ */
+std::istream& operator>>(std::istream& is, Units::Unit& u);
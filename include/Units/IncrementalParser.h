@@ -0,0 +1,88 @@
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "Quantity.h"
+
+namespace Units
+{
+	/**
+	 * @brief Resumable push parser for quantities arriving in chunks
+	 *
+	 * Bytes are fed in arbitrary chunks (as read from a socket or a pipe),
+	 * and every completed quantity is handed to a callback. Quantities are
+	 * separated by any of a set of ASCII delimiters (a newline by default),
+	 * so a chunk may end anywhere: in the middle of a number, of a unit or
+	 * even of a multi-byte UTF-8 character.
+	 *
+	 * Every byte is scanned for delimiters exactly once. Records that lie
+	 * entirely within one chunk are parsed in place; only the unfinished
+	 * tail of a chunk is carried over to the next call.
+	 *
+	 * Quantities that cannot be parsed are reported like
+	 * @ref Units::to_quantity() does, with an error unit. Blank records are
+	 * skipped, and a trailing `\r` is ignored.
+	 *
+	 * Records longer than a maximum length are reported as a single error
+	 * as soon as they exceed it, without buffering the rest of them: the
+	 * following bytes are skipped up to the next delimiter, where parsing
+	 * resumes. This bounds the memory used by a stream without delimiters.
+	 */
+	class IncrementalParser
+	{
+	public:
+		using Callback = std::function<void(const Quantity&)>;
+
+	private:
+		Callback m_Callback;
+		bool m_IsDelimiter[256];
+		char m_SingleDelimiter;
+		std::string m_Partial;
+		size_t m_MaxRecordLength;
+		bool m_Discarding;
+		size_t m_Count;
+
+		void emit(const char* first, const char* last);
+		void overflow();
+
+	public:
+		/**
+		 * @brief Constructor
+		 *
+		 * @param callback         Function called with every completed quantity
+		 * @param delimiters       ASCII characters that separate quantities
+		 * @param maxRecordLength  Maximum length of a record in bytes, not
+		 *                         counting its delimiter (64 KiB by default)
+		 */
+		explicit IncrementalParser(Callback callback, const std::string& delimiters = "\n", size_t maxRecordLength = 65536);
+
+		/**
+		 * @brief Feed a chunk of UTF-8 bytes
+		 *
+		 * @returns the amount of quantities completed by this chunk
+		 */
+		size_t feed(const char* data, size_t length);
+
+		/** @brief Feed a chunk of UTF-8 bytes */
+		size_t feed(const std::string& data) { return feed(data.data(), data.size()); }
+
+		/**
+		 * @brief Signal the end of the input
+		 *
+		 * Parses the last quantity if the input did not end with a delimiter
+		 * (unless it was too long, and has already been reported).
+		 *
+		 * @returns the amount of quantities completed (zero or one)
+		 */
+		size_t finish();
+
+		/** @brief Returns whether there is an unfinished quantity waiting for more input */
+		bool pending() const { return !m_Partial.empty(); }
+
+		/** @brief Get the total amount of quantities parsed so far */
+		size_t count() const { return m_Count; }
+	};
+}
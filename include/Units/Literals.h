@@ -0,0 +1,563 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#include "Units.h"
+#include "BuiltinNames.h"
+
+#if __cplusplus >= 201402L || (defined(_MSVC_LANG) && _MSVC_LANG >= 201402L)
+
+#if defined(__GNUC__)
+	#pragma GCC diagnostic push
+	#pragma GCC diagnostic ignored "-Wfloat-equal"
+#endif
+
+// Since C++20, literals are always evaluated at compile time
+#if defined(__cpp_consteval)
+	#define UNITS_LITERAL consteval
+#else
+	#define UNITS_LITERAL constexpr
+#endif
+
+namespace Units
+{
+	namespace details
+	{
+		namespace literal
+		{
+			/**
+			 * @brief Reached when a unit literal cannot be parsed
+			 *
+			 * Deliberately not @cpp constexpr @ce: reaching it while evaluating a
+			 * literal at compile time is a compile error. Before C++20, at run
+			 * time, it returns an error unit like @ref Units::to_unit() does.
+			 */
+			inline Unit invalid_unit_literal() { return Unit::error(); }
+
+			/** @brief Run-time counterpart of @ref invalid_unit_literal() for quantities */
+			inline Quantity invalid_quantity_literal() { return Quantity(0.0, Unit::error()); }
+
+			/**
+			 * @brief Compile-time counterpart of a parsed quantity
+			 *
+			 * Holds the magnitude (prefixes and numbers) apart from the unit,
+			 * like the run-time parser does. Units are combined with the
+			 * @cpp constexpr @ce operators of @ref Unit, so the result is the
+			 * same as parsing at run time.
+			 */
+			struct Term
+			{
+				double magnitude;
+				Unit unit;
+
+				constexpr Term() : magnitude(1.0), unit() {}
+				constexpr Term(double mag, const Unit& un) : magnitude(mag), unit(un) {}
+			};
+
+			template<typename T>
+			constexpr T power(T value, int exp)
+			{
+				T ret = 1;
+				for(int i = 0; i < (exp < 0 ? -exp : exp); i++) ret *= value;
+				return (exp < 0 ? 1 / ret : ret);
+			}
+
+			constexpr Term mul(const Term& lhs, const Term& rhs) { return Term(lhs.magnitude * rhs.magnitude, lhs.unit * rhs.unit); }
+			constexpr Term div(const Term& lhs, const Term& rhs) { return Term(lhs.magnitude / rhs.magnitude, lhs.unit / rhs.unit); }
+			constexpr Term pow(const Term& un, int exp) { return Term(power(un.magnitude, exp), un.unit ^ exp); }
+
+			/** @brief Character type of UTF-8 string literals (`char8_t` since C++20) */
+			using u8char = typename std::remove_cv<typename std::remove_reference<decltype(u8""[0])>::type>::type;
+
+			struct Symbol
+			{
+				const u8char* name;
+				Unit unit;
+			};
+
+#define UNITS_LITERAL_SYMBOL(symbol, un) { symbol, un },
+#define UNITS_LITERAL_NAME(un, name) { name, un },
+
+			/** @brief Built-in symbol table of the parser */
+			constexpr Symbol symbols[] = { UNITS_BUILTIN_SYMBOLS(UNITS_LITERAL_SYMBOL) };
+
+			/** @brief Names the registry starts out with */
+			constexpr Symbol names[] = { UNITS_BUILTIN_NAMES(UNITS_LITERAL_NAME) };
+
+#undef UNITS_LITERAL_SYMBOL
+#undef UNITS_LITERAL_NAME
+
+			constexpr bool equal(const char* name, size_t length, const u8char* symbol)
+			{
+				size_t i = 0;
+				for(; i < length; i++)
+					if(symbol[i] == 0 || (unsigned char)symbol[i] != (unsigned char)name[i]) return false;
+
+				return symbol[i] == 0;
+			}
+
+			template<size_t Size>
+			constexpr bool lookup(const Symbol (&table)[Size], const char* name, size_t length, Unit& out)
+			{
+				for(const Symbol& sym : table)
+				{
+					if(equal(name, length, sym.name))
+					{
+						out = sym.unit;
+						return true;
+					}
+				}
+
+				return false;
+			}
+
+			// See details::lookup_prefix()
+			constexpr double lookup_prefix(const char* name, size_t length, size_t& prefixLength)
+			{
+				prefixLength = 0;
+				if(length == 0) return 1.0;
+
+				prefixLength = 1;
+
+				switch(name[0])
+				{
+					case 'Y': return yotta;
+					case 'Z': return zetta;
+					case 'E': return exa;
+					case 'P': return peta;
+					case 'T': return tera;
+					case 'G': return giga;
+					case 'M': return mega;
+					case 'k': return kilo;
+					case 'h': return hecto;
+					case 'c': return centi;
+					case 'm': return milli;
+					case 'u': return micro;
+					case 'n': return nano;
+					case 'p': return pico;
+					case 'f': return femto;
+					case 'a': return atto;
+					case 'z': return zepto;
+					case 'y': return yocto;
+
+					case 'd':
+						if(length >= 2 && name[1] == 'a')
+						{
+							prefixLength = 2;
+							return deca;
+						}
+
+						return deci;
+
+					default: break;
+				}
+
+				if(length >= 2 && ((name[0] == '\xC2' && name[1] == '\xB5') || (name[0] == '\xCE' && name[1] == '\xBC')))
+				{
+					prefixLength = 2;
+					return micro;
+				}
+
+				prefixLength = 0;
+				return 1.0;
+			}
+
+			// See details::lookup_builtin(). Grams are a thousandth of a kilogram
+			constexpr bool lookup_builtin(const char* name, size_t length, double& multiplier, Unit& out)
+			{
+				if(length == 1 && name[0] == 'g')
+				{
+					multiplier *= 0.001;
+					out = kg;
+					return true;
+				}
+
+				return lookup(symbols, name, length, out);
+			}
+
+			// See details::resolve_unit(). Names of the registry come after the
+			// symbols of the parser, and names registered at run time are unknown
+			constexpr bool resolve_unit(const char* name, size_t length, double& multiplier, Unit& out)
+			{
+				multiplier = 1.0;
+				if(lookup_builtin(name, length, multiplier, out) || lookup(names, name, length, out)) return true;
+
+				size_t prefixLength = 0;
+				multiplier = lookup_prefix(name, length, prefixLength);
+
+				if(prefixLength == 0 || prefixLength == length) return false;
+				return lookup_builtin(name + prefixLength, length - prefixLength, multiplier, out)
+					|| lookup(names, name + prefixLength, length - prefixLength, out);
+			}
+
+			/**
+			 * @brief Compile-time parser for unit literals
+			 *
+			 * Follows the grammar (and the quirks) of the run-time parser in
+			 * `Input.cpp` step by step. Anything the run-time parser would
+			 * reject, and any trailing character it would ignore, marks the
+			 * literal as malformed.
+			 */
+			class Parser
+			{
+			private:
+				static constexpr char32_t EOF_MARK = 0xFFFFFFFF;
+
+				const char* m_Ptr;
+				const char* m_Last;
+				bool m_Failed;
+
+				constexpr char32_t decode(const char* it, size_t& length) const
+				{
+					const unsigned char lead = (unsigned char)*it;
+					length = 1;
+
+					if(lead < 0x80) return lead;
+
+					size_t n = 0;
+					char32_t cp = 0;
+
+					/**/ if((lead & 0xE0) == 0xC0) { n = 2; cp = lead & 0x1F; }
+					else if((lead & 0xF0) == 0xE0) { n = 3; cp = lead & 0x0F; }
+					else if((lead & 0xF8) == 0xF0) { n = 4; cp = lead & 0x07; }
+					else return 0xFFFD;
+
+					if((size_t)(m_Last - it) < n) return 0xFFFD;
+
+					for(size_t i = 1; i < n; i++)
+					{
+						const unsigned char cont = (unsigned char)it[i];
+						if((cont & 0xC0) != 0x80) return 0xFFFD;
+
+						cp = (cp << 6) | (cont & 0x3F);
+					}
+
+					length = n;
+					return cp;
+				}
+
+				constexpr char32_t current() const
+				{
+					size_t length = 0;
+					return (m_Ptr == m_Last ? EOF_MARK : decode(m_Ptr, length));
+				}
+
+				static constexpr bool is_space(char32_t ch)
+				{
+					return ch == ' ' || ch == '\t' || ch == '\n' || ch == '\v' || ch == '\f' || ch == '\r';
+				}
+
+				static constexpr bool is_letter(char32_t ch)
+				{
+					return (ch >= 'a' && ch <= 'z') || (ch >= 'A' && ch <= 'Z');
+				}
+
+				static constexpr bool is_digit(char ch) { return ch >= '0' && ch <= '9'; }
+
+				static constexpr bool is_superscript(char32_t ch)
+				{
+					return ch == 0x2070 || ch == 0x00B9 || (ch >= 0x00B2 && ch <= 0x00B3) || (ch >= 0x2074 && ch <= 0x2079);
+				}
+
+				static constexpr int superscript_value(char32_t ch)
+				{
+					return (ch == 0x2070 ? 0 : (ch == 0x00B9 ? 1 : (ch <= 0x00B3 ? (int)(ch - 0x00B0) : (int)(ch - 0x2070))));
+				}
+
+				constexpr char32_t advance(bool skipws = false)
+				{
+					if(m_Ptr == m_Last) return EOF_MARK;
+
+					size_t length = 0;
+					decode(m_Ptr, length);
+					m_Ptr += length;
+
+					if(skipws)
+						while(m_Ptr != m_Last && is_space((char32_t)*m_Ptr)) ++m_Ptr;
+
+					return current();
+				}
+
+				constexpr bool accept(char32_t ch)
+				{
+					if(current() != ch) return false;
+
+					advance();
+					return true;
+				}
+
+				constexpr void skip_spaces()
+				{
+					if(is_space(current())) advance(true);
+				}
+
+				// Decimal numbers only: mantissas of up to 19 significant digits
+				// and exponents up to 22 are exact, larger ones may differ from
+				// the run-time parser in the last bit
+				constexpr bool number(double& value)
+				{
+					const char* it = m_Ptr;
+					while(it != m_Last && is_space((char32_t)*it)) ++it;
+
+					bool negative = false;
+					if(it != m_Last && (*it == '+' || *it == '-')) negative = (*it++ == '-');
+
+					uint64_t mantissa = 0;
+					int significant = 0;
+					int exponent = 0;
+					bool any = false;
+
+					for(; it != m_Last && is_digit(*it); ++it, any = true)
+					{
+						if(significant < 19) { mantissa = 10 * mantissa + (uint64_t)(*it - '0'); if(mantissa != 0) significant++; }
+						else exponent++;
+					}
+
+					if(it != m_Last && *it == '.')
+					{
+						const char* fraction = it + 1;
+
+						for(; fraction != m_Last && is_digit(*fraction); ++fraction, any = true)
+						{
+							if(significant < 19) { mantissa = 10 * mantissa + (uint64_t)(*fraction - '0'); if(mantissa != 0) significant++; exponent--; }
+						}
+
+						if(any) it = fraction;
+					}
+
+					if(!any) return false;
+
+					if(it != m_Last && (*it == 'e' || *it == 'E'))
+					{
+						const char* exp = it + 1;
+						bool expNegative = false;
+
+						if(exp != m_Last && (*exp == '+' || *exp == '-')) expNegative = (*exp++ == '-');
+
+						if(exp != m_Last && is_digit(*exp))
+						{
+							int e = 0;
+							for(; exp != m_Last && is_digit(*exp); ++exp)
+								if(e < 100000) e = 10 * e + (*exp - '0');
+
+							exponent += (expNegative ? -e : e);
+							it = exp;
+						}
+					}
+
+					double ret = (double)mantissa;
+					for(; exponent > 22; exponent -= 22) ret *= 1e22;
+					for(; exponent < -22; exponent += 22) ret /= 1e22;
+					ret = (exponent < 0 ? ret / power(10.0, -exponent) : ret * power(10.0, exponent));
+
+					value = (negative ? -ret : ret);
+					m_Ptr = it;
+					return true;
+				}
+
+				// Buffer::parseInt(), but a missing number is an error
+				constexpr int integer()
+				{
+					const char* it = m_Ptr;
+					while(it != m_Last && is_space((char32_t)*it)) ++it;
+
+					bool negative = false;
+					if(it != m_Last && (*it == '+' || *it == '-')) negative = (*it++ == '-');
+
+					if(it == m_Last || !is_digit(*it))
+					{
+						m_Failed = true;
+						return 0;
+					}
+
+					int ret = 0;
+					for(; it != m_Last && is_digit(*it); ++it)
+						ret = 10 * ret + (*it - '0');
+
+					m_Ptr = it;
+					return (negative ? -ret : ret);
+				}
+
+				constexpr int superscript_exponent()
+				{
+					skip_spaces();
+
+					int ret = 0;
+					bool neg = false;
+
+					/**/ if(accept(0x207B)) neg = true;
+					else if(accept(0x207A)) neg = false;
+
+					while(is_superscript(current()))
+					{
+						ret = 10 * ret + superscript_value(current());
+						advance();
+					}
+
+					return (neg ? -ret : ret);
+				}
+
+				constexpr Term unit()
+				{
+					const char* name = m_Ptr;
+
+					while(is_letter(current())
+						|| current() == '$'
+						|| current() == '%'
+						|| current() == 0x221A  // Square root symbol
+						|| current() == 0x2126  // Ohm symbol
+						|| current() == 0x00B5  // Micro symbol
+						|| current() == 0x00B0  // Degree symbol
+						|| current() == 0x03BC) // Greek mu symbol
+					{
+						advance();
+					}
+
+					double prefix = 1.0;
+					Unit un;
+
+					if(!resolve_unit(name, (size_t)(m_Ptr - name), prefix, un))
+					{
+						m_Failed = true;
+						return Term();
+					}
+
+					Term ret(prefix, un);
+
+					if(accept('^'))
+						ret = pow(ret, integer());
+					else if(current() == 0x207A || current() == 0x207B || is_superscript(current()))
+						ret = pow(ret, superscript_exponent());
+
+					return ret;
+				}
+
+				constexpr Term factor()
+				{
+					if(accept('('))
+					{
+						Term expr = expression(false);
+
+						if(!accept(')'))
+						{
+							m_Failed = true;
+							return expr;
+						}
+
+						if(expr.magnitude == 0.0) expr.magnitude = 1.0;
+						return expr;
+					}
+
+					return unit();
+				}
+
+			public:
+				constexpr Parser(const char* first, const char* last)
+					: m_Ptr(first), m_Last(last), m_Failed(false) {}
+
+				constexpr Term term()
+				{
+					skip_spaces();
+
+					Term ret = factor();
+
+					while(!m_Failed
+						&& (current() == ' '
+						|| current() == '*'
+						|| current() == '.'
+						|| current() == '/'
+						|| current() == '('))
+					{
+						const bool divide = (current() == '/');
+
+						if(advance(true) != '(' && !is_letter(current())) continue;
+						ret = (divide ? div(ret, factor()) : mul(ret, factor()));
+					}
+
+					return ret;
+				}
+
+				constexpr Term expression(bool required)
+				{
+					skip_spaces();
+
+					double value = 0.0;
+					if(!number(value) && required) m_Failed = true;
+
+					Term ret = term();
+					ret.magnitude *= value;
+					return ret;
+				}
+
+				/** @brief Returns whether the whole string was parsed into a valid unit */
+				constexpr bool succeeded(const Term& result)
+				{
+					skip_spaces();
+					return !m_Failed && m_Ptr == m_Last && !result.unit.is_error();
+				}
+			};
+		}
+	}
+
+	namespace literals
+	{
+		/**
+		 * @brief Unit literal, such as @cpp "kg*m/s^2"_unit @ce
+		 *
+		 * Parses the string with the grammar of @ref to_unit() at compile time
+		 * when the result is used as a constant expression (for example, to
+		 * initialize a @cpp constexpr @ce variable). A malformed string, an
+		 * unknown symbol or trailing characters are then a compile error.
+		 *
+		 * Every built-in name of the parser and of the registry is known (see
+		 * `BuiltinNames.h`), but names added to the registry at run time cannot
+		 * be used in literals.
+		 *
+		 * @warning Since C++20 the literal is @cpp consteval @ce, so a malformed
+		 * literal is always a compile error. Before C++20, a literal that is not
+		 * used as a constant expression may be parsed at run time, and a
+		 * malformed one then silently returns @ref Unit::error() instead of
+		 * failing to compile. Initialize a @cpp constexpr @ce variable with it
+		 * to have it checked.
+		 */
+		UNITS_LITERAL Unit operator""_unit(const char* str, size_t length)
+		{
+			details::literal::Parser parser(str, str + length);
+			const details::literal::Term term = parser.term();
+
+			return (parser.succeeded(term)
+				? Unit(term.magnitude, term.unit)
+				: details::literal::invalid_unit_literal());
+		}
+
+		/**
+		 * @brief Quantity literal, such as @cpp "9.81 m/s^2"_q @ce
+		 *
+		 * Parses the string with the grammar of @ref to_quantity() at compile
+		 * time, like @ref operator""_unit() does. The number is required.
+		 *
+		 * @warning Before C++20, a malformed literal parsed at run time silently
+		 * returns a quantity with the unit @ref Unit::error(), see
+		 * @ref operator""_unit().
+		 */
+		UNITS_LITERAL Quantity operator""_q(const char* str, size_t length)
+		{
+			details::literal::Parser parser(str, str + length);
+			const details::literal::Term term = parser.expression(true);
+
+			return (parser.succeeded(term)
+				? Quantity(term.magnitude, term.unit)
+				: details::literal::invalid_quantity_literal());
+		}
+	}
+}
+
+#undef UNITS_LITERAL
+
+#if defined(__GNUC__)
+	#pragma GCC diagnostic pop
+#endif
+
+#endif
@@ -0,0 +1,88 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "QuantityArray.h"
+
+namespace Units
+{
+	/** @brief Options for the bulk loaders */
+	struct LoadOptions
+	{
+		/** @brief Amount of worker threads. Zero uses the hardware concurrency */
+		unsigned threads;
+
+		/**
+		 * @brief Approximate size in bytes of the chunks parsed by each task
+		 *
+		 * Chunks are extended up to the next newline, so no line is ever
+		 * split between two tasks.
+		 */
+		size_t chunk_size;
+
+		LoadOptions(unsigned nthreads = 0, size_t chunk = 1 << 20)
+			: threads(nthreads), chunk_size(chunk) {}
+	};
+
+	/** @brief Line that could not be parsed */
+	struct LoadError
+	{
+		/** @brief Line number, starting at 1 */
+		size_t line;
+
+		/** @brief Byte offset of the start of the line */
+		size_t offset;
+	};
+
+	/** @brief Quantities of a single unit, with the line each one came from */
+	struct QuantityColumn
+	{
+		QuantityArray values;
+		std::vector<size_t> lines;
+	};
+
+	/** @brief Result of a bulk load */
+	struct LoadResult
+	{
+		/**
+		 * @brief Parsed quantities, bucketed by unit
+		 *
+		 * Columns are sorted by the first line in which their unit appears,
+		 * and the values of each column keep the order of the input.
+		 */
+		std::vector<QuantityColumn> columns;
+
+		/** @brief Lines that could not be parsed, in input order */
+		std::vector<LoadError> errors;
+
+		/** @brief Total amount of lines, including blank and invalid ones */
+		size_t lines;
+
+		/** @brief Whether the input could be read */
+		bool ok;
+	};
+
+	/**
+	 * @brief Parse a buffer of newline-separated quantities
+	 *
+	 * Every non-blank line must contain one quantity (such as `12.5 kPa` or
+	 * `3 m/s`). Lines may end in `\n` or `\r\n`. The buffer is split into
+	 * newline-aligned chunks that are parsed in parallel, and every distinct
+	 * unit suffix is parsed only once per chunk.
+	 *
+	 * Lines without a number or whose unit cannot be parsed are reported as
+	 * errors and skipped.
+	 */
+	LoadResult parse_quantities(const char* first, const char* last, const LoadOptions& options = LoadOptions());
+
+	/**
+	 * @brief Load a file of newline-separated quantities
+	 *
+	 * The file is memory-mapped and parsed as in @ref parse_quantities().
+	 * If the file cannot be opened or mapped, the result is empty and its
+	 * @ref LoadResult::ok flag is @cpp false @ce.
+	 */
+	LoadResult load_quantities(const std::string& path, const LoadOptions& options = LoadOptions());
+}
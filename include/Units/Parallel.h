@@ -0,0 +1,58 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include "QuantityArray.h"
+
+namespace Units
+{
+	/** @brief Options for the parallel reductions */
+	struct ReductionOptions
+	{
+		/** @brief Amount of worker threads. Zero uses the hardware concurrency */
+		unsigned threads;
+
+		/**
+		 * @brief Amount of elements reduced by each task
+		 *
+		 * In deterministic mode, this (and not the amount of threads) defines
+		 * the shape of the reduction tree, so it must be kept the same to get
+		 * bit-identical results between runs.
+		 */
+		size_t chunk_size;
+
+		/**
+		 * @brief Whether results must be independent of the amount of threads
+		 *
+		 * When enabled, the input is split into fixed-size chunks that are
+		 * reduced in a fixed pairwise tree, so the result is bit-identical for
+		 * any amount of threads and any scheduling. When disabled, every
+		 * thread reduces one contiguous slice, which is slightly faster but
+		 * whose result depends on the amount of threads.
+		 */
+		bool deterministic;
+
+		ReductionOptions(unsigned nthreads = 0, size_t chunk = 65536, bool det = true)
+			: threads(nthreads), chunk_size(chunk), deterministic(det) {}
+	};
+
+	namespace Stats
+	{
+		/**
+		 * @brief Parallel compensated sum
+		 *
+		 * Ranges of quantities are normalized to the unit of their first
+		 * element, resolving conversions once per chunk. If the range mixes
+		 * incompatible dimensions, the result is NaN with an error unit.
+		 */
+		Quantity parallel_sum(const QuantityArray& values, const ReductionOptions& options = ReductionOptions());
+		Quantity parallel_sum(const Quantity* first, const Quantity* last, const ReductionOptions& options = ReductionOptions());
+		Quantity parallel_sum(const std::vector<Quantity>& values, const ReductionOptions& options = ReductionOptions());
+
+		/** @brief Parallel arithmetic mean, see @ref parallel_sum() */
+		Quantity parallel_mean(const QuantityArray& values, const ReductionOptions& options = ReductionOptions());
+		Quantity parallel_mean(const Quantity* first, const Quantity* last, const ReductionOptions& options = ReductionOptions());
+		Quantity parallel_mean(const std::vector<Quantity>& values, const ReductionOptions& options = ReductionOptions());
+	}
+}
@@ -0,0 +1,88 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+#include "Quantity.h"
+
+namespace Units
+{
+	/**
+	 * @brief Bounded, thread-safe memoizing cache in front of the parser
+	 *
+	 * Repeated unit strings (such as `kWh` or `m/s^2`) are parsed once and
+	 * then served from the cache. For quantities, only the unit suffix is
+	 * cached: the numeric part is still parsed every time, so a handful of
+	 * units can serve millions of different values.
+	 *
+	 * The cache is split into independently locked shards (selected by the
+	 * hash of the string), so concurrent readers rarely contend. Each shard
+	 * holds a bounded amount of entries and evicts with the CLOCK algorithm
+	 * (an approximation of LRU that does not reorder entries on every hit).
+	 *
+	 * The results are exactly the same as those of @ref to_unit() and
+	 * @ref to_quantity(), even after units are registered: entries remember
+	 * the registry snapshot they were parsed with, and stale ones are parsed
+	 * again. Strings longer than @ref MAX_KEY_LENGTH bytes are parsed
+	 * without being cached.
+	 */
+	class ParseCache
+	{
+	public:
+		/** @brief Cache statistics */
+		struct Statistics
+		{
+			uint64_t hits;
+			uint64_t misses;
+			uint64_t evictions;
+		};
+
+		/** @brief Longest string (in bytes) that will be cached */
+		static constexpr size_t MAX_KEY_LENGTH = 64;
+
+	private:
+		class Shard;
+
+		std::unique_ptr<Shard[]> m_Shards;
+		size_t m_ShardCount;
+
+		std::atomic<uint64_t> m_Hits;
+		std::atomic<uint64_t> m_Misses;
+		std::atomic<uint64_t> m_Evictions;
+
+		Quantity term(const char* first, const char* last);
+
+	public:
+		/**
+		 * @brief Constructor. Creates an empty cache
+		 *
+		 * @param capacity  Maximum amount of cached strings
+		 * @param shards    Amount of independently locked shards
+		 */
+		explicit ParseCache(size_t capacity = 1024, size_t shards = 16);
+
+		/** @brief Destructor */
+		~ParseCache();
+
+		ParseCache(const ParseCache&) = delete;
+		ParseCache& operator=(const ParseCache&) = delete;
+
+		/** @brief Convert a UTF-8 string to a unit, see @ref Units::to_unit() */
+		Unit to_unit(const std::string& str);
+
+		/** @brief Convert a UTF-8 string to a quantity, see @ref Units::to_quantity() */
+		Quantity to_quantity(const std::string& str);
+
+		/** @brief Get the amount of cached strings */
+		size_t size() const;
+
+		/** @brief Remove every cached string. Statistics are kept */
+		void clear();
+
+		/** @brief Get the hit, miss and eviction counters */
+		Statistics statistics() const;
+	};
+}
@@ -0,0 +1,120 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include "Conversion.h"
+#include "Quantity.h"
+
+namespace Units
+{
+	/**
+	 * @brief Mergeable streaming quantile sketch of quantities
+	 *
+	 * Implements a merging t-digest: inserted values are buffered and
+	 * periodically merged into a bounded amount of weighted centroids, whose
+	 * size only depends on the compression parameter and not on the amount of
+	 * inserted values. Quantiles are estimated with a small relative error,
+	 * which is smallest near the tails (p99, p999...).
+	 *
+	 * The unit of the sketch is fixed by the first inserted quantity, and any
+	 * other compatible quantity is converted to that unit on insertion.
+	 *
+	 * Queries never modify the sketch, so several threads may read the same
+	 * sketch at once, but inserting and merging need exclusive access. To
+	 * collect statistics from several threads, give each thread its own
+	 * sketch (so inserting never needs a lock) and @ref merge() them
+	 * afterwards.
+	 */
+	class QuantileSketch
+	{
+	private:
+		struct Centroid
+		{
+			double mean;
+			double weight;
+		};
+
+		double m_Compression;
+		Unit m_Unit;
+		bool m_HasUnit;
+
+		std::vector<Centroid> m_Centroids;
+		std::vector<Centroid> m_Buffer;
+		size_t m_BufferCapacity;
+
+		double m_Count;
+		double m_Min;
+		double m_Max;
+
+		Unit m_LastUnit;
+		Conversion m_LastConversion;
+
+		static void compress(std::vector<Centroid>& buffer, const std::vector<Centroid>& centroids, double total, double compression, std::vector<Centroid>& out);
+		void compress();
+		void add(double value, double weight);
+
+	public:
+		/**
+		 * @brief Constructor. Creates an empty sketch
+		 *
+		 * @param compression  Accuracy/size trade-off. The sketch will keep
+		 *                     roughly this many centroids
+		 */
+		explicit QuantileSketch(double compression = 100.0);
+
+		/** @brief Constructor. Creates an empty sketch with a fixed unit */
+		QuantileSketch(Unit un, double compression = 100.0);
+
+		/** @brief Get the unit of this sketch */
+		Unit unit() const { return m_Unit; }
+
+		/** @brief Get the number of inserted values */
+		double count() const { return m_Count; }
+
+		/** @brief Returns whether no values have been inserted */
+		bool empty() const { return m_Count <= 0.0; }
+
+		/**
+		 * @brief Insert a quantity
+		 *
+		 * @returns @cpp false @ce (without inserting anything) if the quantity
+		 * is NaN or its dimensions are not compatible with the sketch
+		 */
+		bool insert(const Quantity& q);
+
+		/** @brief Insert a magnitude already expressed in the unit of the sketch */
+		void insert(double magnitude);
+
+		/**
+		 * @brief Merge another sketch into this one
+		 *
+		 * The centroids of the other sketch are converted to the unit of this
+		 * sketch (or adopted as-is if this sketch has no unit yet). A sketch
+		 * may be merged into itself, which doubles the weight of every value.
+		 *
+		 * @returns @cpp false @ce (without merging anything) if the sketches
+		 * have incompatible units
+		 */
+		bool merge(const QuantileSketch& other);
+
+		/**
+		 * @brief Estimate a quantile
+		 *
+		 * @param q  Quantile to estimate, in the range [0, 1]
+		 *
+		 * Returns the estimated quantile in the unit of the sketch. If the
+		 * sketch is empty, the magnitude is NaN.
+		 */
+		Quantity quantile(double q) const;
+
+		/** @brief Estimate a quantile, expressed in the given (compatible) unit */
+		Quantity quantile(double q, const Unit& un) const;
+
+		/** @brief Get the smallest inserted value */
+		Quantity min() const;
+
+		/** @brief Get the largest inserted value */
+		Quantity max() const;
+	};
+}
@@ -0,0 +1,122 @@
+#pragma once
+
+#include <cstddef>
+#include <iterator>
+#include <vector>
+
+#include "Quantity.h"
+
+namespace Units
+{
+	/**
+	 * @brief Column of quantities sharing a single unit
+	 *
+	 * Stores the magnitudes contiguously and the unit only once, so that bulk
+	 * operations can work on plain doubles and resolve any unit arithmetic a
+	 * single time for the whole column.
+	 */
+	class QuantityArray
+	{
+	private:
+		std::vector<double> m_Magnitudes;
+		Unit m_Unit;
+
+	public:
+		/** @brief Read-only iterator that yields the elements as quantities */
+		class const_iterator
+		{
+		private:
+			const double* m_Ptr;
+			Unit m_Unit;
+
+		public:
+			using iterator_category = std::forward_iterator_tag;
+			using value_type        = Quantity;
+			using difference_type   = std::ptrdiff_t;
+			using pointer           = void;
+			using reference         = Quantity;
+
+			const_iterator() : m_Ptr(nullptr), m_Unit() {}
+			const_iterator(const double* ptr, Unit un) : m_Ptr(ptr), m_Unit(un) {}
+
+			Quantity operator*() const { return Quantity(*m_Ptr, m_Unit); }
+
+			const_iterator& operator++()    { ++m_Ptr; return *this; }
+			const_iterator  operator++(int) { const_iterator tmp = *this; ++m_Ptr; return tmp; }
+
+			bool operator==(const const_iterator& other) const { return m_Ptr == other.m_Ptr; }
+			bool operator!=(const const_iterator& other) const { return m_Ptr != other.m_Ptr; }
+		};
+
+		/** @brief Constructor. Creates an empty array of the given unit */
+		explicit QuantityArray(Unit un = Unit());
+
+		/** @brief Constructor. Creates an array from raw magnitudes in the given unit */
+		QuantityArray(std::vector<double> magnitudes, Unit un);
+
+		/**
+		 * @brief Constructor. Creates an array from a range of quantities
+		 *
+		 * The unit of the array will be the unit of the first quantity. The
+		 * rest of the quantities are converted to that unit, and any quantity
+		 * with incompatible dimensions is stored as NaN.
+		 */
+		QuantityArray(const Quantity* first, const Quantity* last);
+
+		/** @brief Constructor. Creates an array from a vector of quantities */
+		explicit QuantityArray(const std::vector<Quantity>& quantities);
+
+		/** @brief Get the unit shared by all elements */
+		Unit unit() const { return m_Unit; }
+
+		/** @brief Get the number of elements */
+		size_t size() const { return m_Magnitudes.size(); }
+
+		/** @brief Returns whether the array has no elements */
+		bool empty() const { return m_Magnitudes.empty(); }
+
+		/** @brief Get a pointer to the contiguous magnitudes */
+		double*       data()       { return m_Magnitudes.data(); }
+		const double* data() const { return m_Magnitudes.data(); }
+
+		/** @brief Get the underlying magnitudes */
+		const std::vector<double>& magnitudes() const { return m_Magnitudes; }
+
+		/** @brief Get an iterator to the first element */
+		const_iterator begin() const { return const_iterator(data(), m_Unit); }
+
+		/** @brief Get an iterator past the last element */
+		const_iterator end() const { return const_iterator(data() + size(), m_Unit); }
+
+		/** @brief Get the element at the given index as a quantity */
+		Quantity operator[](size_t index) const { return Quantity(m_Magnitudes[index], m_Unit); }
+
+		/** @brief Reserve storage for the given amount of elements */
+		void reserve(size_t n) { m_Magnitudes.reserve(n); }
+
+		/** @brief Resize the array, filling new elements with the given magnitude */
+		void resize(size_t n, double value = 0.0) { m_Magnitudes.resize(n, value); }
+
+		/** @brief Remove all elements, keeping the unit */
+		void clear() { m_Magnitudes.clear(); }
+
+		/** @brief Append a magnitude expressed in the unit of this array */
+		void push_back(double magnitude) { m_Magnitudes.push_back(magnitude); }
+
+		/**
+		 * @brief Append a quantity
+		 *
+		 * The quantity is converted to the unit of this array. If its
+		 * dimensions are not compatible, NaN is stored instead.
+		 */
+		void push_back(const Quantity& quantity);
+
+		/**
+		 * @brief Convert the whole array to another unit
+		 *
+		 * The conversion factor is resolved once. If the units are not
+		 * compatible, an empty array with an error unit is returned.
+		 */
+		QuantityArray convert(const Unit& result) const;
+	};
+}
@@ -0,0 +1,95 @@
+#pragma once
+
+#include "QuantityArray.h"
+
+namespace Units
+{
+	/**
+	 * @brief Time series of quantities
+	 *
+	 * Pairs a time column with a value column of the same length. All the
+	 * calculus operations compute the unit of their result once (using unit
+	 * arithmetic) and then work on the raw magnitudes, so that the result of,
+	 * for example, integrating a series of `W` over `h` is a series of `Wh`.
+	 */
+	class QuantitySeries
+	{
+	private:
+		QuantityArray m_Time;
+		QuantityArray m_Values;
+
+	public:
+		/** @brief Constructor. Creates an empty series with the given units */
+		QuantitySeries(Unit timeUnit = Unit::second(), Unit valueUnit = Unit());
+
+		/**
+		 * @brief Constructor. Creates a series from a time and a value column
+		 *
+		 * If both columns have different lengths, the longest one is
+		 * truncated to the length of the shortest one.
+		 */
+		QuantitySeries(QuantityArray time, QuantityArray values);
+
+		/** @brief Get the time column */
+		const QuantityArray& time() const { return m_Time; }
+
+		/** @brief Get the value column */
+		const QuantityArray& values() const { return m_Values; }
+
+		/** @brief Get the number of samples */
+		size_t size() const { return m_Values.size(); }
+
+		/** @brief Returns whether the series has no samples */
+		bool empty() const { return m_Values.empty(); }
+
+		/** @brief Reserve storage for the given amount of samples */
+		void reserve(size_t n);
+
+		/**
+		 * @brief Append a sample
+		 *
+		 * Both quantities are converted to the units of their respective
+		 * columns. Samples are expected to be appended in increasing time
+		 * order.
+		 */
+		void push_back(const Quantity& time, const Quantity& value);
+
+		/**
+		 * @brief Rate of change of the series
+		 *
+		 * Computes the forward finite difference between consecutive samples,
+		 * stamped at the time of the later sample (so the result has one
+		 * sample less). The unit of the result is `value / time`, so a series
+		 * of bytes over seconds yields a series of `B/s`.
+		 */
+		QuantitySeries derivative() const;
+
+		/**
+		 * @brief Running integral of the series
+		 *
+		 * Integrates the series using the trapezoidal rule, starting at zero
+		 * on the first sample. The unit of the result is `value * time`.
+		 */
+		QuantitySeries cumulative_integral() const;
+
+		/**
+		 * @brief Total integral of the series
+		 *
+		 * Integrates the whole series using the trapezoidal rule. The unit of
+		 * the result is `value * time`, so a series of `W` over `h` yields `Wh`.
+		 */
+		Quantity integral() const;
+
+		/**
+		 * @brief Resample the series at a fixed interval
+		 *
+		 * Linearly interpolates the series at every multiple of the given
+		 * interval, starting at the first sample and stopping at the last one.
+		 * If the interval is not a positive time compatible with the time
+		 * column, if the first or last time is not finite or the last one is
+		 * before the first, or if the result would exceed 2^24 samples, an
+		 * empty series is returned.
+		 */
+		QuantitySeries resample(const Quantity& interval) const;
+	};
+}
@@ -0,0 +1,71 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "Unit.h"
+
+namespace Units
+{
+	/** @brief How a registered unit name is used */
+	enum UnitFlags : unsigned
+	{
+		/** @brief The parser accepts the name (with or without an SI prefix) */
+		UNIT_PARSE  = 1u << 0,
+
+		/** @brief The formatter displays the unit with this name */
+		UNIT_FORMAT = 1u << 1,
+
+		/** @brief The formatter scales quantities of this unit with SI prefixes */
+		UNIT_PREFIX = 1u << 2
+	};
+
+	/** @brief Named unit, as stored in the registry */
+	struct UnitDefinition
+	{
+		/** @brief UTF-8 name of the unit */
+		std::string name;
+
+		/** @brief Unit the name stands for */
+		Unit unit;
+
+		/** @brief Combination of @ref UnitFlags */
+		unsigned flags;
+	};
+
+	/**
+	 * @brief Register a unit name for both parsing and formatting
+	 *
+	 * The registry holds every named unit known to @ref to_unit(),
+	 * @ref to_quantity() and @ref to_string(), and starts out with the
+	 * built-in names. A name registered again replaces the unit it parses
+	 * to, and a unit registered again with @ref UNIT_FORMAT replaces the name
+	 * it is displayed with.
+	 *
+	 * The symbols of the parser (SI units such as `m`, `kg` and `N`, but
+	 * also common ones such as `h`, `min`, `mi` or `dB`, see
+	 * `BuiltinNames.h`) always take precedence when parsing, so they cannot
+	 * be registered with @ref UNIT_PARSE as a different unit. Other
+	 * built-in names (`ft`, `bar`...) can be replaced.
+	 *
+	 * Writers are serialized and publish a new immutable snapshot of the
+	 * registry; parsers and formatters never lock, they read whichever
+	 * snapshot is current. Older snapshots are freed by later writers once
+	 * no reader uses them. Every registration copies the registry, so prefer
+	 * @ref register_units() to register many units at once. Results held
+	 * by a @ref ParseCache or by the formatter are recomputed.
+	 *
+	 * @returns @cpp false @ce (registering nothing) if the name is empty, the
+	 * unit is an error, no flag is set, or the name is a symbol of the parser
+	 * registered with @ref UNIT_PARSE as a different unit
+	 */
+	bool register_unit(const std::string& name, const Unit& unit, unsigned flags = UNIT_PARSE | UNIT_FORMAT);
+
+	/**
+	 * @brief Register several units, publishing a single snapshot
+	 *
+	 * @returns @cpp false @ce (registering nothing) if any of the
+	 * definitions is not valid, see @ref register_unit()
+	 */
+	bool register_units(const std::vector<UnitDefinition>& units);
+}
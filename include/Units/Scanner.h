@@ -0,0 +1,66 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "Quantity.h"
+
+namespace Units
+{
+	/** @brief Options for @ref scan_quantities() */
+	struct ScanOptions
+	{
+		/**
+		 * @brief Unit symbols to accept, exactly as written in the text
+		 *
+		 * For example, `{ "ms", "s" }` accepts `12 ms` but not `12 us`. An
+		 * empty list accepts every unit known to the parser.
+		 *
+		 * Many unit symbols are also short English words, so without a
+		 * whitelist prose yields false positives: `found 3 in the list` is
+		 * read as 3 inches, `10 at once` as 10 technical atmospheres and
+		 * `5 a day` as 5 ares. Give the expected units when scanning text
+		 * that is not known to contain only quantities.
+		 */
+		std::vector<std::string> units;
+
+		ScanOptions() = default;
+		ScanOptions(std::vector<std::string> whitelist) : units(std::move(whitelist)) {}
+	};
+
+	/** @brief Quantity found in a text */
+	struct QuantityMatch
+	{
+		/** @brief Byte offset of the first character (the sign or first digit) */
+		size_t offset;
+
+		/** @brief Length in bytes, up to the end of the unit */
+		size_t length;
+
+		/** @brief Parsed quantity, as @ref to_quantity() would return it */
+		Quantity quantity;
+	};
+
+	/**
+	 * @brief Find the quantities embedded in free-form text
+	 *
+	 * Looks for a number followed by a unit, optionally separated by a single
+	 * space, such as `latency=12.3 ms` or `-3dBm`. Numbers that are part of a
+	 * word (`x86`, `v1.2`) or not followed by a valid unit are skipped. The
+	 * unit ends at the first whitespace or punctuation other than `/`, `*`
+	 * and `^`, so it may be a compound unit (`9.81 m/s^2`).
+	 *
+	 * Numbers written with digit group separators or a decimal comma
+	 * (`1,000 ms`, `3,5 ms`) are skipped as a whole rather than read in part.
+	 *
+	 * Units are read like @ref to_unit() does. In particular, binary
+	 * prefixes are not known (`4 KiB` is never matched) and `B` is the bel,
+	 * not the byte, so `4 kB` is matched as 4 kilobels. Include such units
+	 * in a whitelist only if that is the intended meaning.
+	 *
+	 * Digits are located with SIMD instructions where available, and every
+	 * distinct unit text is parsed only once per call.
+	 */
+	std::vector<QuantityMatch> scan_quantities(const char* first, const char* last, const ScanOptions& options = ScanOptions());
+}
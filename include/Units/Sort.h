@@ -0,0 +1,67 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include "Quantity.h"
+
+namespace Units
+{
+	/**
+	 * @brief Sort a range of quantities by their physical magnitude
+	 *
+	 * Quantities may have different units as long as all of them share the
+	 * same dimensions, which is checked once before sorting. Every quantity is
+	 * normalized to SI units once to build a sort key, and the keys are sorted
+	 * using a LSD radix sort on their IEEE-754 representation. The quantities
+	 * themselves (magnitude and unit) are moved around untouched.
+	 *
+	 * NaN magnitudes are sorted after every other value.
+	 *
+	 * @returns @cpp false @ce (leaving the range untouched) if the quantities
+	 * do not share the same dimensions, @cpp true @ce otherwise
+	 */
+	bool sort(Quantity* first, Quantity* last);
+
+	/** @brief Sort a vector of quantities by their physical magnitude */
+	bool sort(std::vector<Quantity>& values);
+
+	/**
+	 * @brief Stable sort a range of quantities by their physical magnitude
+	 *
+	 * Same as @ref sort(), which is already stable. Equivalent quantities keep
+	 * their relative order.
+	 */
+	bool stable_sort(Quantity* first, Quantity* last);
+
+	/** @brief Stable sort a vector of quantities by their physical magnitude */
+	bool stable_sort(std::vector<Quantity>& values);
+
+	/**
+	 * @brief Partially sort a range of quantities by their physical magnitude
+	 *
+	 * Rearranges the range such that the element at @p nth is the one that
+	 * would be there if the range was sorted, every element before it is not
+	 * greater and every element after it is not smaller.
+	 *
+	 * @returns @cpp false @ce (leaving the range untouched) if the quantities
+	 * do not share the same dimensions, @cpp true @ce otherwise
+	 */
+	bool nth_element(Quantity* first, Quantity* nth, Quantity* last);
+
+	/** @brief Partially sort a vector of quantities by their physical magnitude */
+	bool nth_element(std::vector<Quantity>& values, size_t nth);
+
+	/**
+	 * @brief Get the @p k largest quantities of a range
+	 *
+	 * Returns (at most) @p k quantities in descending order of physical
+	 * magnitude. NaN magnitudes rank below every other value. If the
+	 * quantities do not share the same dimensions, an empty vector is
+	 * returned.
+	 */
+	std::vector<Quantity> top_k(const Quantity* first, const Quantity* last, size_t k);
+
+	/** @brief Get the @p k largest quantities of a vector */
+	std::vector<Quantity> top_k(const std::vector<Quantity>& values, size_t k);
+}
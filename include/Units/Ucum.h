@@ -0,0 +1,54 @@
+#pragma once
+
+#include <string>
+
+#include "IO.h"
+
+namespace Units
+{
+	/**
+	 * @brief Parse a UCUM case-sensitive code from a range of ASCII bytes
+	 *
+	 * Understands the c/s syntax of the Unified Code for Units of Measure:
+	 * products and quotients (`kg.m/s2`, `/min`), integer exponents
+	 * (`m.s-2`), integer factors and powers of ten (`10*3/uL`),
+	 * parentheses, annotations (`{cells}/uL`, which are dimensionless) and
+	 * bracketed atoms (`mm[Hg]`, `[psi]`, `[in_i]`). Atoms map onto the units
+	 * of the catalog (`Cel` is @cpp Temperature::degC @ce, `mm[Hg]` is
+	 * @cpp Pressure::mmHg @ce) and only metric atoms accept a prefix.
+	 *
+	 * The atoms are looked up through a `switch` over their compile-time
+	 * hashes, like the native grammar, and neither the registry nor the
+	 * heap are used unless there are parentheses.
+	 *
+	 * Works like @ref parse_unit(): leading whitespace is skipped, parsing
+	 * stops at the first character that is not part of the code, and
+	 * @p out is only assigned on success.
+	 */
+	ParseResult parse_ucum(const char* first, const char* last, Unit& out, const ParseLimits& limits = ParseLimits());
+
+	/**
+	 * @brief Convert a UCUM case-sensitive code to a unit
+	 *
+	 * See @ref parse_ucum(). If the whole string is not a valid code,
+	 * @cpp Units::error @ce is returned.
+	 */
+	Unit ucum_to_unit(const std::string& code);
+
+	/**
+	 * @brief Convert a unit to a UCUM case-sensitive code
+	 *
+	 * Units of the catalog become their atom, with a prefix or a power if
+	 * needed (`mm[Hg]`, `kPa`, `[psi]`, `m3`, `/s2`). Otherwise, the shorter
+	 * of the base units, with a power of ten or an integer as factor (`kg.m`,
+	 * `10*3`, `10*12.m-3`), and an atom divided or multiplied by a common unit
+	 * (`km/h`, `mg/dL`, `kW.h`) is chosen.
+	 *
+	 * Temperatures are written in kelvin, since degrees Celsius and kelvin
+	 * are the same unit in this library.
+	 *
+	 * @returns an empty string for error units and for units that cannot be
+	 *          written exactly in UCUM
+	 */
+	std::string to_ucum(const Unit& unit);
+}
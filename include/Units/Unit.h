@@ -13,6 +13,15 @@ namespace Units
 		/** @brief Round a number to the maximum precision of a float */
 		static float cround(float val);
 
+		/** @brief Integer power, by squaring so that huge exponents stay cheap */
+		static constexpr float power(float value, int exp)
+		{
+			return (exp == 0 ? 1.0f
+				: exp < 0 ? 1.0f / power(value, -exp)
+				: exp % 2 != 0 ? value * power(value, exp - 1)
+				: power(value * value, exp / 2));
+		}
+
 		constexpr Unit(float multiplier, const UnitData& dim)
 			: m_Multiplier(multiplier), m_Data(dim) {}
 
@@ -28,6 +37,9 @@ namespace Units
 		/** @brief Get base units of this unit */
 		UnitData::BaseUnitType base_units() const;
 
+		/** @brief Get the exponent of a base unit in this unit */
+		int exponent(UnitData::BaseUnit base) const;
+
 		/** @brief Get multiplier of this unit */
 		float multiplier() const;
 
@@ -37,6 +49,9 @@ namespace Units
 		/** @brief Get the number of base SI units that form this unit */
 		int unit_count() const;
 
+		/** @brief Returns a unit with the given multiplier and dimensions */
+		static constexpr Unit from_data(float multiplier, const UnitData& dim) { return Unit(multiplier, dim); }
+
 		/** @brief Constructor. Initializes an equation unit */
 		static constexpr Unit eq(uint8_t num) { return Unit(1.0f, UnitData::eq(num)); }
 
@@ -65,16 +80,19 @@ namespace Units
 		/** @brief Returns a unit that represents a unit of count */
 		static constexpr Unit count() { return Unit(1.0f, UnitData::count()); }
 
+		/** @brief Returns whether this is an error unit */
+		constexpr bool is_error() const { return m_Data.is_error(); }
+
 		/** @brief Exponent operator. Calculates the unit to the given power */
-		Unit operator^(const int exp) const;
+		constexpr Unit operator^(const int exp) const { return Unit(power(m_Multiplier, exp), m_Data ^ exp); }
 		/** @brief Add operator */
 		Unit operator+(const Unit& rhs) const;
 		/** @brief Subtract operator */
 		Unit operator-(const Unit& rhs) const;
 		/** @brief Product operator */
-		Unit operator*(const Unit& rhs) const;
+		constexpr Unit operator*(const Unit& rhs) const { return Unit(m_Multiplier * rhs.m_Multiplier, m_Data * rhs.m_Data); }
 		/** @brief Division operator */
-		Unit operator/(const Unit& rhs) const;
+		constexpr Unit operator/(const Unit& rhs) const { return Unit(m_Multiplier / rhs.m_Multiplier, m_Data / rhs.m_Data); }
 
 		/** @brief Exponent operator */
 		Unit& operator^=(const int exp);
@@ -33,8 +33,40 @@ namespace Units
 				  candela(Cd), currency(c), count(cnt), e_flag(eflag), i_flag(iflag), eq_flag(eqflag) {}
 		} m_Data;
 
-		bool isRootHz() const;
-		bool isHz() const;
+		constexpr bool isRootHz() const
+		{
+			return m_Data.meter    == 0
+				&& m_Data.kilogram == 0
+				&& m_Data.second   == -1
+				&& m_Data.ampere   == 0
+				&& m_Data.kelvin   == 0
+				&& m_Data.radians  == 0
+				&& m_Data.mole     == 0
+				&& m_Data.candela  == 0
+				&& m_Data.currency == 0
+				&& m_Data.count    == 0
+				&& m_Data.e_flag   == 0
+				&& m_Data.i_flag   == 1
+				&& m_Data.eq_flag  == 0;
+		}
+
+		constexpr bool isHz() const
+		{
+			return m_Data.meter    == 0
+				&& m_Data.kilogram == 0
+				&& m_Data.second   <  0
+				&& m_Data.ampere   == 0
+				&& m_Data.kelvin   == 0
+				&& m_Data.radians  == 0
+				&& m_Data.mole     == 0
+				&& m_Data.candela  == 0
+				&& m_Data.currency == 0
+				&& m_Data.count    == 0
+				&& m_Data.e_flag   == 0
+				&& m_Data.i_flag   == 0
+				&& m_Data.eq_flag  == 0;
+		}
+
 		bool hasValidRoot(int power) const;
 
 		constexpr UnitData(int8_t m, int8_t kg, int8_t s, int8_t A, int8_t K, int8_t mol, int8_t rad, int8_t Cd, int8_t c, int8_t cnt, bool eflag, bool iflag, bool eqflag)
@@ -56,6 +88,12 @@ namespace Units
 				: UnitData((num & 0x03) >> 0, (num & 0x1C) >> 2));
 		}
 
+		/** @brief Returns the unit data with the given exponent of every base unit and flags */
+		static constexpr UnitData from_exponents(int8_t m, int8_t kg, int8_t s, int8_t A, int8_t K, int8_t mol, int8_t rad, int8_t Cd, int8_t c, int8_t cnt, bool eflag, bool iflag, bool eqflag)
+		{
+			return UnitData(m, kg, s, A, K, mol, rad, Cd, c, cnt, eflag, iflag, eqflag);
+		}
+
 		/** @brief Returns the unit data that represents a meter */
 		static constexpr UnitData meter   () { return UnitData(1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0); }
 		/** @brief Returns the unit data that represents a kilogram */
@@ -84,9 +122,15 @@ namespace Units
 		/** @brief Alias for the base unit type */
 		using BaseUnitType = uint32_t;
 
+		/** @brief Base units, in the order of the arguments of @ref from_exponents() */
+		enum BaseUnit { METER, KILOGRAM, SECOND, AMPERE, KELVIN, MOLE, RADIAN, CANDELA, CURRENCY, COUNT };
+
 		/** @brief Get the unit data representation as integer type */
 		BaseUnitType base_unit() const;
 
+		/** @brief Get the exponent of a base unit */
+		int exponent(BaseUnit base) const;
+
 		/** @brief Equality comparison operator */
 		bool operator==(const UnitData& other) const;
 		/** @brief Inequality comparison operator */
@@ -110,12 +154,46 @@ namespace Units
 		 */
 		int degree() const;
 
+		/** @brief Returns whether this is the unit data of an error unit */
+		constexpr bool is_error() const { return m_Data.e_flag; }
+
+		// The operators are constexpr so that the catalog in Units.h can be
+		// used in constant expressions. Exponents out of range wrap around
+		// like the bit-fields do at run time
+
 		/** @brief Exponent operator. Returns this unit raised to the nth power */
-		UnitData operator^(int n) const;
+		constexpr UnitData operator^(int n) const
+		{
+			return UnitData(
+				m_Data.meter * n, m_Data.kilogram * n, m_Data.second * (isRootHz() ? n / 2 : n),
+				m_Data.ampere * n, m_Data.kelvin * n, m_Data.mole * n, m_Data.radians * n,
+				m_Data.candela * n, m_Data.currency * n, m_Data.count * n,
+				m_Data.e_flag, m_Data.i_flag && n % 2 != 0, m_Data.eq_flag);
+		}
+
 		/** @brief Product operator */
-		UnitData operator*(const UnitData& rhs) const;
+		constexpr UnitData operator*(const UnitData& rhs) const
+		{
+			return UnitData(
+				m_Data.meter + rhs.m_Data.meter, m_Data.kilogram + rhs.m_Data.kilogram,
+				m_Data.second + (isRootHz() && rhs.isRootHz() ? 0 : rhs.m_Data.second),
+				m_Data.ampere + rhs.m_Data.ampere, m_Data.kelvin + rhs.m_Data.kelvin, m_Data.mole + rhs.m_Data.mole,
+				m_Data.radians + rhs.m_Data.radians, m_Data.candela + rhs.m_Data.candela,
+				m_Data.currency + rhs.m_Data.currency, m_Data.count + rhs.m_Data.count,
+				m_Data.e_flag || rhs.m_Data.e_flag, m_Data.i_flag != rhs.m_Data.i_flag, m_Data.eq_flag || rhs.m_Data.eq_flag);
+		}
+
 		/** @brief Division operator */
-		UnitData operator/(const UnitData& rhs) const;
+		constexpr UnitData operator/(const UnitData& rhs) const
+		{
+			return UnitData(
+				m_Data.meter - rhs.m_Data.meter, m_Data.kilogram - rhs.m_Data.kilogram,
+				m_Data.second - (isHz() && rhs.isRootHz() ? 0 : rhs.m_Data.second),
+				m_Data.ampere - rhs.m_Data.ampere, m_Data.kelvin - rhs.m_Data.kelvin, m_Data.mole - rhs.m_Data.mole,
+				m_Data.radians - rhs.m_Data.radians, m_Data.candela - rhs.m_Data.candela,
+				m_Data.currency - rhs.m_Data.currency, m_Data.count - rhs.m_Data.count,
+				m_Data.e_flag || rhs.m_Data.e_flag, m_Data.i_flag != rhs.m_Data.i_flag, m_Data.eq_flag != rhs.m_Data.eq_flag);
+		}
 
 		/** @brief Power function. Performs the nth power on this unit */
 		void pow(int n);
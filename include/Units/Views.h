@@ -0,0 +1,219 @@
+#pragma once
+
+#include <cstddef>
+#include <cstring>
+#include <iterator>
+
+#if __cplusplus >= 202002L
+#include <ranges>
+#endif
+
+#include "Conversion.h"
+#include "Quantity.h"
+
+namespace Units
+{
+	/**
+	 * @brief Lazy views over ranges of quantities
+	 *
+	 * Views are built by piping a range of quantities (any type with
+	 * `begin()` and `end()` yielding @ref Quantity, including
+	 * @ref QuantityArray) through one or more adaptors:
+	 *
+	 * @code{.cpp}
+	 * for(double x : quantities | Units::views::convert_to(km) | Units::views::magnitudes)
+	 *     ...
+	 * @endcode
+	 *
+	 * Adaptors can also be applied to an iterator pair, such as
+	 * `Units::views::convert_to(km)(first, last)`.
+	 *
+	 * Views never allocate nor copy the underlying range, which must outlive
+	 * them. Conversions are resolved when the view is built (for the unit of
+	 * the first element) and only resolved again if an element with a
+	 * different unit is found. When compiled as C++20, views are
+	 * `std::ranges::view`s and can be combined with the standard adaptors.
+	 */
+	namespace views
+	{
+		namespace details
+		{
+			inline bool same_unit(const Unit& a, const Unit& b)
+			{
+				return std::memcmp(&a, &b, sizeof(Unit)) == 0;
+			}
+
+#if __cplusplus >= 202002L
+			using view_base = std::ranges::view_base;
+#else
+			struct view_base {};
+#endif
+		}
+
+		/** @brief View of quantities converted to a fixed unit */
+		template<typename Iterator>
+		class convert_view : public details::view_base
+		{
+		public:
+			class iterator
+			{
+			private:
+				Iterator m_It;
+				Unit m_Target;
+				mutable Unit m_Source;
+				mutable Conversion m_Conversion;
+
+			public:
+				using iterator_category = std::input_iterator_tag;
+#if __cplusplus >= 202002L
+				using iterator_concept  = std::forward_iterator_tag;
+#endif
+				using value_type        = Quantity;
+				using difference_type   = std::ptrdiff_t;
+				using pointer           = void;
+				using reference         = Quantity;
+
+				iterator() : m_It(), m_Target(), m_Source(), m_Conversion() {}
+				iterator(Iterator it, Unit target, Unit source, Conversion conv)
+					: m_It(it), m_Target(target), m_Source(source), m_Conversion(conv) {}
+
+				Quantity operator*() const
+				{
+					const Quantity q = *m_It;
+					const Unit un = q.unit();
+
+					if(!details::same_unit(un, m_Source))
+					{
+						m_Source = un;
+						m_Conversion = Conversion(un, m_Target);
+					}
+
+					if(!m_Conversion.valid()) return Quantity(m_Conversion(q.magnitude()), Unit::error());
+					return Quantity(m_Conversion(q.magnitude()), m_Target);
+				}
+
+				iterator& operator++()    { ++m_It; return *this; }
+				iterator  operator++(int) { iterator tmp = *this; ++m_It; return tmp; }
+
+				bool operator==(const iterator& other) const { return m_It == other.m_It; }
+				bool operator!=(const iterator& other) const { return m_It != other.m_It; }
+			};
+
+		private:
+			iterator m_Begin;
+			iterator m_End;
+
+		public:
+			convert_view() : m_Begin(), m_End() {}
+
+			/** @brief Constructor. Resolves the conversion for the first element */
+			convert_view(Iterator first, Iterator last, const Unit& target)
+			{
+				const Unit source = (first != last ? (*first).unit() : target);
+				const Conversion conv(source, target);
+
+				m_Begin = iterator(first, target, source, conv);
+				m_End = iterator(last, target, source, conv);
+			}
+
+			iterator begin() const { return m_Begin; }
+			iterator end() const { return m_End; }
+			bool empty() const { return m_Begin == m_End; }
+		};
+
+		/** @brief View of the magnitudes of quantities */
+		template<typename Iterator>
+		class magnitude_view : public details::view_base
+		{
+		public:
+			class iterator
+			{
+			private:
+				Iterator m_It;
+
+			public:
+				using iterator_category = std::input_iterator_tag;
+#if __cplusplus >= 202002L
+				using iterator_concept  = std::forward_iterator_tag;
+#endif
+				using value_type        = double;
+				using difference_type   = std::ptrdiff_t;
+				using pointer           = void;
+				using reference         = double;
+
+				iterator() : m_It() {}
+				explicit iterator(Iterator it) : m_It(it) {}
+
+				double operator*() const { return (*m_It).magnitude(); }
+
+				iterator& operator++()    { ++m_It; return *this; }
+				iterator  operator++(int) { iterator tmp = *this; ++m_It; return tmp; }
+
+				bool operator==(const iterator& other) const { return m_It == other.m_It; }
+				bool operator!=(const iterator& other) const { return m_It != other.m_It; }
+			};
+
+		private:
+			iterator m_Begin;
+			iterator m_End;
+
+		public:
+			magnitude_view() : m_Begin(), m_End() {}
+			magnitude_view(Iterator first, Iterator last) : m_Begin(first), m_End(last) {}
+
+			iterator begin() const { return m_Begin; }
+			iterator end() const { return m_End; }
+			bool empty() const { return m_Begin == m_End; }
+		};
+
+		/** @brief Adaptor created by @ref convert_to() */
+		class convert_adaptor
+		{
+		private:
+			Unit m_Target;
+
+		public:
+			explicit convert_adaptor(Unit target) : m_Target(target) {}
+
+			Unit target() const { return m_Target; }
+
+			template<typename Iterator>
+			convert_view<Iterator> operator()(Iterator first, Iterator last) const
+			{
+				return convert_view<Iterator>(first, last, m_Target);
+			}
+		};
+
+		/** @brief Adaptor of @ref magnitudes */
+		class magnitudes_adaptor
+		{
+		public:
+			template<typename Iterator>
+			magnitude_view<Iterator> operator()(Iterator first, Iterator last) const
+			{
+				return magnitude_view<Iterator>(first, last);
+			}
+		};
+
+		/** @brief Converts every quantity to the given unit */
+		inline convert_adaptor convert_to(const Unit& target) { return convert_adaptor(target); }
+
+		/** @brief Converts every quantity to the unit of the given quantity (such as `10.0*km`) */
+		inline convert_adaptor convert_to(const Quantity& target) { return convert_adaptor(Unit(target.magnitude(), target.unit())); }
+
+		/** @brief Strips the unit of every quantity, yielding its magnitude */
+		constexpr magnitudes_adaptor magnitudes = magnitudes_adaptor();
+
+		template<typename Range>
+		auto operator|(const Range& range, const convert_adaptor& adaptor) -> convert_view<decltype(std::begin(range))>
+		{
+			return adaptor(std::begin(range), std::end(range));
+		}
+
+		template<typename Range>
+		auto operator|(const Range& range, const magnitudes_adaptor& adaptor) -> magnitude_view<decltype(std::begin(range))>
+		{
+			return adaptor(std::begin(range), std::end(range));
+		}
+	}
+}
@@ -0,0 +1,98 @@
+#pragma once
+
+#include <cmath>
+#include <cstddef>
+
+namespace Units
+{
+	/**
+	 * @brief Compensated (Neumaier) summation over several independent lanes
+	 *
+	 * Keeping a few independent running sums lets the compiler vectorize the
+	 * main loop, while the compensation term of every lane recovers the
+	 * low-order bits lost on each addition. The lanes are combined (also with
+	 * compensation) when the result is requested.
+	 */
+	class Accumulator
+	{
+	private:
+		static constexpr size_t LANES = 4;
+
+		double m_Sum[LANES];
+		double m_Compensation[LANES];
+
+		static void add(double& sum, double& comp, double value)
+		{
+			const double t = sum + value;
+			comp += (std::fabs(sum) >= std::fabs(value) ? (sum - t) + value : (value - t) + sum);
+			sum = t;
+		}
+
+	public:
+		/** @brief Constructor. Creates an accumulator with a sum of zero */
+		Accumulator()
+			: m_Sum{ 0.0, 0.0, 0.0, 0.0 }, m_Compensation{ 0.0, 0.0, 0.0, 0.0 } {}
+
+		/** @brief Adds a single value */
+		void add(double value) { add(m_Sum[0], m_Compensation[0], value); }
+
+		/** @brief Adds a contiguous range of values */
+		void add(const double* data, size_t n)
+		{
+			size_t i = 0;
+
+			for(; i + LANES <= n; i += LANES)
+				for(size_t lane = 0; lane < LANES; lane++)
+					add(m_Sum[lane], m_Compensation[lane], data[i + lane]);
+
+			for(; i < n; i++)
+				add(m_Sum[0], m_Compensation[0], data[i]);
+		}
+
+		/** @brief Adds the squared deviation from the given mean of a contiguous range of values */
+		void add_squared_deviation(const double* data, size_t n, double mean)
+		{
+			size_t i = 0;
+
+			for(; i + LANES <= n; i += LANES)
+			{
+				for(size_t lane = 0; lane < LANES; lane++)
+				{
+					const double d = data[i + lane] - mean;
+					add(m_Sum[lane], m_Compensation[lane], d * d);
+				}
+			}
+
+			for(; i < n; i++)
+			{
+				const double d = data[i] - mean;
+				add(m_Sum[0], m_Compensation[0], d * d);
+			}
+		}
+
+		/** @brief Merges another accumulator into this one */
+		void add(const Accumulator& other)
+		{
+			for(size_t lane = 0; lane < LANES; lane++)
+			{
+				add(m_Sum[lane], m_Compensation[lane], other.m_Sum[lane]);
+				add(m_Sum[lane], m_Compensation[lane], other.m_Compensation[lane]);
+			}
+		}
+
+		/** @brief Get the compensated sum */
+		double result() const
+		{
+			double sum = 0.0;
+			double comp = 0.0;
+
+			for(size_t lane = 0; lane < LANES; lane++)
+			{
+				add(sum, comp, m_Sum[lane]);
+				add(sum, comp, m_Compensation[lane]);
+			}
+
+			return sum + comp;
+		}
+	};
+}
@@ -0,0 +1,170 @@
+#include <cmath>
+#include <limits>
+
+#include "Units/Aggregate.h"
+#include "Accumulator.h"
+#include "Normalize.h"
+
+namespace Units
+{
+	namespace details
+	{
+		static const double NaN = std::numeric_limits<double>::quiet_NaN();
+
+		// Running minimum and maximum of a range, ignoring NaN values
+		struct Extrema
+		{
+			double min = std::numeric_limits<double>::infinity();
+			double max = -std::numeric_limits<double>::infinity();
+			bool any = false;
+
+			void add(const double* data, size_t n)
+			{
+				double lo = min, hi = max;
+				bool found = any;
+
+				for(size_t i = 0; i < n; i++)
+				{
+					const double x = data[i];
+					lo = (x < lo ? x : lo);
+					hi = (x > hi ? x : hi);
+					found = found || !std::isnan(x);
+				}
+
+				min = lo;
+				max = hi;
+				any = found;
+			}
+		};
+
+		static Quantity error() { return Quantity(NaN, Unit::error()); }
+
+		static Quantity variance(const double* data, size_t n, Unit un, bool sample)
+		{
+			const size_t dof = (sample ? 1 : 0);
+			if(n <= dof) return Quantity(NaN, un^2);
+
+			Accumulator sum;
+			sum.add(data, n);
+			const double mean = sum.result() / (double)n;
+
+			Accumulator squares;
+			squares.add_squared_deviation(data, n, mean);
+			return Quantity(squares.result() / (double)(n - dof), un^2);
+		}
+	}
+
+	namespace Stats
+	{
+		Quantity sum(const QuantityArray& values)
+		{
+			Accumulator acc;
+			acc.add(values.data(), values.size());
+			return Quantity(acc.result(), values.unit());
+		}
+
+		Quantity sum(const Quantity* first, const Quantity* last)
+		{
+			if(first == last) return Quantity(0.0, Unit());
+
+			Accumulator acc;
+			if(!for_each_block(first, last, first->unit(), [&](const double* data, size_t n) { acc.add(data, n); }))
+				return details::error();
+
+			return Quantity(acc.result(), first->unit());
+		}
+
+		Quantity mean(const QuantityArray& values)
+		{
+			if(values.empty()) return Quantity(details::NaN, values.unit());
+			return Quantity(sum(values).magnitude() / (double)values.size(), values.unit());
+		}
+
+		Quantity mean(const Quantity* first, const Quantity* last)
+		{
+			if(first == last) return Quantity(details::NaN, Unit());
+
+			const Quantity total = sum(first, last);
+			return Quantity(total.magnitude() / (double)(last - first), total.unit());
+		}
+
+		Quantity min(const QuantityArray& values)
+		{
+			details::Extrema ext;
+			ext.add(values.data(), values.size());
+			return Quantity(ext.any ? ext.min : details::NaN, values.unit());
+		}
+
+		Quantity min(const Quantity* first, const Quantity* last)
+		{
+			if(first == last) return Quantity(details::NaN, Unit());
+
+			details::Extrema ext;
+			if(!for_each_block(first, last, first->unit(), [&](const double* data, size_t n) { ext.add(data, n); }))
+				return details::error();
+
+			return Quantity(ext.any ? ext.min : details::NaN, first->unit());
+		}
+
+		Quantity max(const QuantityArray& values)
+		{
+			details::Extrema ext;
+			ext.add(values.data(), values.size());
+			return Quantity(ext.any ? ext.max : details::NaN, values.unit());
+		}
+
+		Quantity max(const Quantity* first, const Quantity* last)
+		{
+			if(first == last) return Quantity(details::NaN, Unit());
+
+			details::Extrema ext;
+			if(!for_each_block(first, last, first->unit(), [&](const double* data, size_t n) { ext.add(data, n); }))
+				return details::error();
+
+			return Quantity(ext.any ? ext.max : details::NaN, first->unit());
+		}
+
+		Quantity variance(const QuantityArray& values, bool sample)
+		{
+			return details::variance(values.data(), values.size(), values.unit(), sample);
+		}
+
+		Quantity variance(const Quantity* first, const Quantity* last, bool sample)
+		{
+			if(first == last) return Quantity(details::NaN, Unit());
+
+			// The deviations need the mean, so normalize into a single column
+			// first instead of converting every quantity twice
+			QuantityArray values(first->unit());
+			values.reserve((size_t)(last - first));
+
+			if(!for_each_block(first, last, first->unit(), [&](const double* data, size_t n) { for(size_t i = 0; i < n; i++) values.push_back(data[i]); }))
+				return details::error();
+
+			return variance(values, sample);
+		}
+
+		Quantity stddev(const QuantityArray& values, bool sample)
+		{
+			const Quantity var = variance(values, sample);
+			return Quantity(std::sqrt(var.magnitude()), values.unit());
+		}
+
+		Quantity stddev(const Quantity* first, const Quantity* last, bool sample)
+		{
+			if(first == last) return Quantity(details::NaN, Unit());
+
+			const Quantity var = variance(first, last, sample);
+			if(var.unit() == Unit::error()) return var;
+
+			return Quantity(std::sqrt(var.magnitude()), first->unit());
+		}
+
+		Quantity sum     (const std::vector<Quantity>& values)              { return sum     (values.data(), values.data() + values.size()); }
+		Quantity mean    (const std::vector<Quantity>& values)              { return mean    (values.data(), values.data() + values.size()); }
+		Quantity min     (const std::vector<Quantity>& values)              { return min     (values.data(), values.data() + values.size()); }
+		Quantity max     (const std::vector<Quantity>& values)              { return max     (values.data(), values.data() + values.size()); }
+		Quantity variance(const std::vector<Quantity>& values, bool sample) { return variance(values.data(), values.data() + values.size(), sample); }
+		Quantity stddev  (const std::vector<Quantity>& values, bool sample) { return stddev  (values.data(), values.data() + values.size(), sample); }
+	}
+}
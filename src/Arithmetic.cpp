@@ -0,0 +1,172 @@
+#include <cstddef>
+#include <cstring>
+#include <utility>
+#include <vector>
+
+#include "Units/Arithmetic.h"
+#include "Units/Conversion.h"
+
+namespace Units
+{
+	namespace details
+	{
+		// Gets the unit shared by every quantity of a range. Returns false if
+		// the quantities do not share a single unit
+		static bool shared_unit(const Quantity* first, const Quantity* last, Unit& un)
+		{
+			if(first == last) return true;
+
+			un = first->unit();
+			for(const Quantity* it = first + 1; it != last; ++it)
+			{
+				const Unit other = it->unit();
+				if(std::memcmp(&other, &un, sizeof(Unit)) != 0 && other != un) return false;
+			}
+
+			return true;
+		}
+
+		// Applies `op` element-wise. The pointers are restrict-qualified so
+		// the loop can be vectorized without runtime aliasing checks
+		template<typename Operation>
+		static QuantityArray transform(const QuantityArray& lhs, const QuantityArray& rhs, const Unit& result, Operation op)
+		{
+			const size_t n = lhs.size();
+			std::vector<double> ret(n);
+
+			const double* __restrict a = lhs.data();
+			const double* __restrict b = rhs.data();
+			double* __restrict out = ret.data();
+
+			for(size_t i = 0; i < n; i++)
+				out[i] = op(a[i], b[i]);
+
+			return QuantityArray(std::move(ret), result);
+		}
+
+		template<typename Operation>
+		static void transform(const Quantity* first1, const Quantity* last1, const Quantity* first2, Quantity* out, const Unit& result, Operation op)
+		{
+			const size_t n = (size_t)(last1 - first1);
+
+			for(size_t i = 0; i < n; i++)
+				out[i] = Quantity(op(first1[i].magnitude(), first2[i].magnitude()), result);
+		}
+	}
+
+	QuantityArray operator+(const QuantityArray& lhs, const QuantityArray& rhs)
+	{
+		const Conversion conv(rhs.unit(), lhs.unit());
+		if(!conv.valid() || lhs.size() != rhs.size()) return QuantityArray(Unit::error());
+
+		const double scale = conv.scale();
+		const double offset = conv.offset();
+		return details::transform(lhs, rhs, lhs.unit(), [=](double a, double b) { return a + (b * scale + offset); });
+	}
+
+	QuantityArray operator-(const QuantityArray& lhs, const QuantityArray& rhs)
+	{
+		const Conversion conv(rhs.unit(), lhs.unit());
+		if(!conv.valid() || lhs.size() != rhs.size()) return QuantityArray(Unit::error());
+
+		const double scale = conv.scale();
+		const double offset = conv.offset();
+		return details::transform(lhs, rhs, lhs.unit(), [=](double a, double b) { return a - (b * scale + offset); });
+	}
+
+	QuantityArray operator*(const QuantityArray& lhs, const QuantityArray& rhs)
+	{
+		if(lhs.size() != rhs.size()) return QuantityArray(Unit::error());
+
+		return details::transform(lhs, rhs, lhs.unit() * rhs.unit(), [](double a, double b) { return a * b; });
+	}
+
+	QuantityArray operator/(const QuantityArray& lhs, const QuantityArray& rhs)
+	{
+		if(lhs.size() != rhs.size()) return QuantityArray(Unit::error());
+
+		return details::transform(lhs, rhs, lhs.unit() / rhs.unit(), [](double a, double b) { return a / b; });
+	}
+
+	QuantityArray fma(const QuantityArray& a, const QuantityArray& b, const QuantityArray& c)
+	{
+		const Unit result = a.unit() * b.unit();
+		const Conversion conv(c.unit(), result);
+		if(!conv.valid() || a.size() != b.size() || a.size() != c.size()) return QuantityArray(Unit::error());
+
+		const size_t n = a.size();
+		std::vector<double> ret(n);
+
+		const double* __restrict x = a.data();
+		const double* __restrict y = b.data();
+		const double* __restrict z = c.data();
+		double* __restrict out = ret.data();
+
+		const double scale = conv.scale();
+		const double offset = conv.offset();
+
+		for(size_t i = 0; i < n; i++)
+			out[i] = x[i] * y[i] + (z[i] * scale + offset);
+
+		return QuantityArray(std::move(ret), result);
+	}
+
+	bool add(const Quantity* first1, const Quantity* last1, const Quantity* first2, Quantity* out)
+	{
+		Unit lhs, rhs;
+		if(!details::shared_unit(first1, last1, lhs) || !details::shared_unit(first2, first2 + (last1 - first1), rhs)) return false;
+
+		const Conversion conv(rhs, lhs);
+		if(first1 != last1 && !conv.valid()) return false;
+
+		details::transform(first1, last1, first2, out, lhs, [&](double a, double b) { return a + conv(b); });
+		return true;
+	}
+
+	bool subtract(const Quantity* first1, const Quantity* last1, const Quantity* first2, Quantity* out)
+	{
+		Unit lhs, rhs;
+		if(!details::shared_unit(first1, last1, lhs) || !details::shared_unit(first2, first2 + (last1 - first1), rhs)) return false;
+
+		const Conversion conv(rhs, lhs);
+		if(first1 != last1 && !conv.valid()) return false;
+
+		details::transform(first1, last1, first2, out, lhs, [&](double a, double b) { return a - conv(b); });
+		return true;
+	}
+
+	bool multiply(const Quantity* first1, const Quantity* last1, const Quantity* first2, Quantity* out)
+	{
+		Unit lhs, rhs;
+		if(!details::shared_unit(first1, last1, lhs) || !details::shared_unit(first2, first2 + (last1 - first1), rhs)) return false;
+
+		details::transform(first1, last1, first2, out, lhs * rhs, [](double a, double b) { return a * b; });
+		return true;
+	}
+
+	bool divide(const Quantity* first1, const Quantity* last1, const Quantity* first2, Quantity* out)
+	{
+		Unit lhs, rhs;
+		if(!details::shared_unit(first1, last1, lhs) || !details::shared_unit(first2, first2 + (last1 - first1), rhs)) return false;
+
+		details::transform(first1, last1, first2, out, lhs / rhs, [](double a, double b) { return a / b; });
+		return true;
+	}
+
+	bool fma(const Quantity* first1, const Quantity* last1, const Quantity* first2, const Quantity* first3, Quantity* out)
+	{
+		const ptrdiff_t n = last1 - first1;
+
+		Unit a, b, c;
+		if(!details::shared_unit(first1, last1, a) || !details::shared_unit(first2, first2 + n, b) || !details::shared_unit(first3, first3 + n, c)) return false;
+
+		const Unit result = a * b;
+		const Conversion conv(c, result);
+		if(n != 0 && !conv.valid()) return false;
+
+		for(ptrdiff_t i = 0; i < n; i++)
+			out[i] = Quantity(first1[i].magnitude() * first2[i].magnitude() + conv(first3[i].magnitude()), result);
+
+		return true;
+	}
+}
@@ -0,0 +1,157 @@
+#include <cmath>
+#include <cstring>
+#include <string>
+#include <unordered_map>
+
+#include "Units/Batch.h"
+#include "Number.h"
+#include "Parser.h"
+#include "Registry.h"
+#include "Symbols.h"
+#include "Tasks.h"
+
+namespace Units
+{
+	namespace details
+	{
+		// Unit suffix already seen in a chunk, with its parsed term or the
+		// reason it could not be parsed
+		struct BatchTerm
+		{
+			std::string suffix;
+			Quantity term;
+			uint8_t status;
+		};
+
+		// Parsing state reused between the strings of a chunk
+		class BatchParser
+		{
+		private:
+			const ParseLimits& m_Limits;
+			std::vector<BatchTerm> m_Terms;
+			std::unordered_map<uint32_t, size_t> m_Index;
+
+			static bool is_space(char ch)
+			{
+				return ch == ' ' || ch == '\t' || ch == '\n' || ch == '\v' || ch == '\f' || ch == '\r';
+			}
+
+			BatchTerm resolve(const char* first, const char* last) const
+			{
+				BatchTerm ret{ std::string(first, last), Quantity(Unit::error()), PARSE_OK };
+
+				const ParseResult result = parse_term(first, last, ret.term, m_Limits);
+				if(result.ec == std::errc::value_too_large) ret.status = PARSE_TOO_LARGE;
+				else if(result.ec != std::errc()) ret.status = PARSE_INVALID;
+
+				return ret;
+			}
+
+		public:
+			explicit BatchParser(const ParseLimits& limits) : m_Limits(limits), m_Terms(), m_Index() {}
+
+			uint8_t parse(const char* first, const char* last, Quantity& out)
+			{
+				out = Unit::error();
+				if((size_t)(last - first) > m_Limits.max_length) return PARSE_TOO_LARGE;
+
+				while(first != last && is_space(*first)) ++first;
+				while(last != first && is_space(last[-1])) --last;
+
+				double value;
+				const char* suffix = parse_number(first, last, value);
+				if(suffix == first) return PARSE_INVALID;
+
+				// Finite digits that overflow (as opposed to a literal "inf")
+				const char* digit = (*first == '+' || *first == '-') ? first + 1 : first;
+				if(std::isinf(value) && (*digit == '.' || (*digit >= '0' && *digit <= '9'))) return PARSE_OUT_OF_RANGE;
+
+				while(suffix != last && is_space(*suffix)) ++suffix;
+
+				// Every distinct suffix is parsed once, and found later by its
+				// hash without building a string
+				const size_t length = (size_t)(last - suffix);
+				const uint32_t h = hash(suffix, length);
+
+				auto it = m_Index.find(h);
+				const BatchTerm* entry = nullptr;
+				BatchTerm uncached;
+
+				if(it != m_Index.end() && m_Terms[it->second].suffix.compare(0, std::string::npos, suffix, length) == 0)
+				{
+					entry = &m_Terms[it->second];
+				}
+				else if(it == m_Index.end())
+				{
+					m_Index.emplace(h, m_Terms.size());
+					m_Terms.push_back(resolve(suffix, last));
+					entry = &m_Terms.back();
+				}
+				else
+				{
+					// Hash collision: resolve without caching
+					uncached = resolve(suffix, last);
+					entry = &uncached;
+				}
+
+				if(entry->status == PARSE_OK) out = value * entry->term;
+				return entry->status;
+			}
+		};
+
+		static const char* text_begin(const TextView& text)    { return text.data; }
+		static const char* text_begin(const std::string& text) { return text.data(); }
+		static const char* text_end(const TextView& text)      { return text.data + text.size; }
+		static const char* text_end(const std::string& text)   { return text.data() + text.size(); }
+
+		template<typename Text>
+		static size_t parse_batch(const Text* inputs, size_t length, Quantity* out, uint8_t* status, const BatchOptions& options)
+		{
+			const size_t chunk = (options.chunk_size == 0 ? 1 : options.chunk_size);
+			const size_t chunks = (length + chunk - 1) / chunk;
+			std::vector<size_t> parsed(chunks, 0);
+
+			// Every task resolves names against the same snapshot of the
+			// registry, pinned once per chunk rather than once per lookup
+			const RegistryGuard registry;
+
+			run_tasks(chunks, worker_count(options.threads, chunks), [&](size_t task) {
+				const RegistryGuard pinned(registry.snapshot());
+				BatchParser parser(options.limits);
+
+				const size_t begin = task * chunk;
+				const size_t end = (length - begin < chunk ? length : begin + chunk);
+
+				for(size_t i = begin; i < end; i++)
+				{
+					const uint8_t result = parser.parse(text_begin(inputs[i]), text_end(inputs[i]), out[i]);
+
+					if(status != nullptr) status[i] = result;
+					if(result == PARSE_OK) parsed[task]++;
+				}
+			});
+
+			size_t ret = 0;
+			for(size_t n : parsed) ret += n;
+			return ret;
+		}
+	}
+
+	size_t parse_batch(const TextView* inputs, size_t length, Quantity* out, uint8_t* status, const BatchOptions& options)
+	{
+		return details::parse_batch(inputs, length, out, status, options);
+	}
+
+	size_t parse_batch(const std::string* inputs, size_t length, Quantity* out, uint8_t* status, const BatchOptions& options)
+	{
+		return details::parse_batch(inputs, length, out, status, options);
+	}
+
+	size_t parse_batch(const std::vector<std::string>& inputs, std::vector<Quantity>& out, std::vector<uint8_t>& status, const BatchOptions& options)
+	{
+		out.resize(inputs.size());
+		status.resize(inputs.size());
+
+		return parse_batch(inputs.data(), inputs.size(), out.data(), status.data(), options);
+	}
+}
@@ -1,112 +1,212 @@
-#include <codecvt>
-#include <locale>
 #include <cstdlib>
+#include <cstring>
 
 #include "Buffer.h"
+#include "Number.h"
 
 namespace Units
 {
+	namespace details
+	{
+		// Longest integer (in bytes) that can be parsed
+		static constexpr size_t NUMBER_BUFFER_SIZE = 64;
+	}
+
+	Buffer::Buffer(const char* begin, const char* end)
+		: storage(), first(begin), last(end), ptr(begin), stack(begin), error(nullptr), limited(false) {}
+
 	Buffer::Buffer(const std::string& str)
-		: str(to_utf16(str)), ptr(0), stack(0) {}
+		: storage(), first(str.data()), last(str.data() + str.size()), ptr(first), stack(first), error(nullptr), limited(false) {}
 
 	Buffer::Buffer(const std::u16string& str)
-		: str(str), ptr(0), stack(0) {}
+		: storage(to_utf8(str)), first(nullptr), last(nullptr), ptr(nullptr), stack(nullptr), error(nullptr), limited(false)
+	{
+		use_storage();
+	}
 
 	Buffer::Buffer(const std::u32string& str)
-		: str(to_utf16(str)), ptr(0), stack(0) {}
+		: storage(to_utf8(str)), first(nullptr), last(nullptr), ptr(nullptr), stack(nullptr), error(nullptr), limited(false)
+	{
+		use_storage();
+	}
 
 	Buffer::Buffer(std::istream& is)
-		: ptr(0), stack(0)
+		: storage(), first(nullptr), last(nullptr), ptr(nullptr), stack(nullptr), error(nullptr), limited(false)
+	{
+		std::getline(is, storage);
+		use_storage();
+	}
+
+	void Buffer::use_storage()
 	{
-		std::string temp;
-		std::getline(is, temp);
-		str = to_utf16(temp);
+		first = storage.data();
+		last = first + storage.size();
+		ptr = stack = first;
 	}
 
-	std::string Buffer::to_utf8(const std::u16string& s)
+	void Buffer::append_utf8(std::string& out, char32_t cp)
 	{
-		try {
-			std::wstring_convert<std::codecvt_utf8_utf16<char16_t>, char16_t> conv;
-			return conv.to_bytes(s);
-		} catch(...) {
-			return std::string();
+		if(cp < 0x80)
+		{
+			out += (char)cp;
+		}
+		else if(cp < 0x800)
+		{
+			out += (char)(0xC0 | (cp >> 6));
+			out += (char)(0x80 | (cp & 0x3F));
+		}
+		else if(cp < 0x10000)
+		{
+			out += (char)(0xE0 | (cp >> 12));
+			out += (char)(0x80 | ((cp >> 6) & 0x3F));
+			out += (char)(0x80 | (cp & 0x3F));
+		}
+		else
+		{
+			out += (char)(0xF0 | (cp >> 18));
+			out += (char)(0x80 | ((cp >> 12) & 0x3F));
+			out += (char)(0x80 | ((cp >> 6) & 0x3F));
+			out += (char)(0x80 | (cp & 0x3F));
 		}
 	}
 
-	std::u16string Buffer::to_utf16(const std::string& str)
+	std::string Buffer::to_utf8(const std::u16string& str)
 	{
-		try {
-			std::wstring_convert<std::codecvt_utf8_utf16<char16_t>, char16_t> conv;
-			return conv.from_bytes(str);
-		} catch(...) {
-			return std::u16string();
+		std::string ret;
+		ret.reserve(str.size());
+
+		for(size_t i = 0; i < str.size(); i++)
+		{
+			char32_t cp = str[i];
+
+			if(cp >= 0xD800 && cp <= 0xDBFF && i + 1 < str.size() && str[i + 1] >= 0xDC00 && str[i + 1] <= 0xDFFF)
+				cp = 0x10000 + ((cp - 0xD800) << 10) + (char32_t)(str[++i] - 0xDC00);
+			else if(cp >= 0xD800 && cp <= 0xDFFF)
+				cp = 0xFFFD;
+
+			append_utf8(ret, cp);
 		}
+
+		return ret;
 	}
 
-	std::u16string Buffer::to_utf16(const std::u32string& str)
+	std::string Buffer::to_utf8(const std::u32string& str)
 	{
-		try {
-			std::wstring_convert<std::codecvt_utf16<char32_t>, char32_t> conv;
-			std::string bytes = conv.to_bytes(str);
-			return std::u16string(reinterpret_cast<const char16_t*>(bytes.c_str()), bytes.length() / sizeof(char16_t));
-		} catch(...) {
-			return std::u16string();
+		std::string ret;
+		ret.reserve(str.size());
+
+		for(char32_t cp : str)
+			append_utf8(ret, (cp > 0x10FFFF || (cp >= 0xD800 && cp <= 0xDFFF)) ? 0xFFFD : cp);
+
+		return ret;
+	}
+
+	char32_t Buffer::decode(const char* it, const char* end, size_t& length)
+	{
+		const unsigned char lead = (unsigned char)*it;
+		length = 1;
+
+		if(lead < 0x80) return lead;
+
+		size_t n;
+		char32_t cp;
+
+		/**/ if((lead & 0xE0) == 0xC0) { n = 2; cp = lead & 0x1F; }
+		else if((lead & 0xF0) == 0xE0) { n = 3; cp = lead & 0x0F; }
+		else if((lead & 0xF8) == 0xF0) { n = 4; cp = lead & 0x07; }
+		else return 0xFFFD;
+
+		if((size_t)(end - it) < n) return 0xFFFD;
+
+		for(size_t i = 1; i < n; i++)
+		{
+			const unsigned char cont = (unsigned char)it[i];
+			if((cont & 0xC0) != 0x80) return 0xFFFD;
+
+			cp = (cp << 6) | (cont & 0x3F);
 		}
+
+		length = n;
+		return cp;
 	}
 
-	bool Buffer::isSpace(char16_t ch)
+	bool Buffer::isSpace(char32_t ch)
 	{
 		return ch == ' '  || ch == '\t'
 			|| ch == '\n' || ch == '\v'
 			|| ch == '\f' || ch == '\r';
 	}
 
-	char16_t Buffer::current() const { return (ptr + 0) < str.size() ? str[ptr + 0] : EOF_MARK; }
-	char16_t Buffer::ahead  () const { return (ptr + 1) < str.size() ? str[ptr + 1] : EOF_MARK; }
+	char32_t Buffer::current() const
+	{
+		if(ptr == last) return EOF_MARK;
+		if((unsigned char)*ptr < 0x80) return (char32_t)*ptr;
+
+		size_t length;
+		return decode(ptr, last, length);
+	}
+
+	char32_t Buffer::ahead() const
+	{
+		if(ptr == last) return EOF_MARK;
+
+		size_t length;
+		decode(ptr, last, length);
+
+		if(ptr + length == last) return EOF_MARK;
+		return decode(ptr + length, last, length);
+	}
 
 	void Buffer::push() { stack = ptr; }
 	void Buffer::pop () { ptr = stack; }
 
 	int Buffer::parseInt()
 	{
-		std::string utf8 = to_utf8(str.substr(ptr));
+		const size_t available = (size_t)(last - ptr);
+		const size_t n = (available < details::NUMBER_BUFFER_SIZE - 1 ? available : details::NUMBER_BUFFER_SIZE - 1);
 
-		const char* begin = utf8.c_str();
-		char* end = nullptr;
+		char number[details::NUMBER_BUFFER_SIZE];
+		std::memcpy(number, ptr, n);
+		number[n] = '\0';
 
-		long ret = strtol(begin, &end, 10);
-		ptr += (size_t)(end - begin);
+		char* end = nullptr;
+		long ret = strtol(number, &end, 10);
+		ptr += (end - number);
 		return static_cast<int>(ret);
 	}
 
 	double Buffer::parseDouble()
 	{
-		std::string utf8 = to_utf8(str.substr(ptr));
-
-		const char* begin = utf8.c_str();
-		char* end = nullptr;
-
-		double ret = strtod(begin, &end);
-		ptr += (size_t)(end - begin);
+		double ret;
+		ptr = details::parse_number(ptr, last, ret);
 		return ret;
 	}
 
-	char16_t Buffer::advance(bool skipws)
+	char32_t Buffer::advance(bool skipws)
 	{
-		if(current() == EOF_MARK) return EOF_MARK;
+		if(ptr == last) return EOF_MARK;
 
-		++ptr;
+		if((unsigned char)*ptr < 0x80)
+		{
+			++ptr;
+		}
+		else
+		{
+			size_t length;
+			decode(ptr, last, length);
+			ptr += length;
+		}
 
 		if(skipws)
 		{
-			while(isSpace(current()))
+			while(ptr != last && isSpace((char32_t)*ptr))
 				++ptr;
 		}
 
 		return current();
 	}
 
-	bool Buffer::accept(char16_t chr)
+	bool Buffer::accept(char32_t chr)
 	{
 		if(chr != current()) return false;
 
@@ -1,26 +1,47 @@
 #pragma once
 
+#include <cstddef>
 #include <cstdint>
 #include <string>
 #include <istream>
 
 namespace Units
 {
+	/**
+	 * @brief Read-only cursor over a UTF-8 string
+	 *
+	 * The buffer walks the UTF-8 bytes in place: code points are decoded on
+	 * demand, with a fast path for ASCII. Strings given as UTF-8 are never
+	 * copied, so the caller must keep them alive while the buffer is in use.
+	 * UTF-16 and UTF-32 strings (and stream input) are transcoded to UTF-8
+	 * once, into storage owned by the buffer.
+	 */
 	class Buffer
 	{
 	private:
-		std::u16string str;
-		size_t ptr;
-		size_t stack;
+		std::string storage;
+		const char* first;
+		const char* last;
+		const char* ptr;
+		const char* stack;
+		const char* error;
+		bool limited;
 
-		static std::u16string to_utf16(const std::string& str);
-		static std::u16string to_utf16(const std::u32string& str);
-		static std::string    to_utf8 (const std::u16string& str);
+		static std::string to_utf8(const std::u16string& str);
+		static std::string to_utf8(const std::u32string& str);
 
-		static bool isSpace(char16_t ch);
+		static void append_utf8(std::string& out, char32_t cp);
+		static char32_t decode(const char* it, const char* end, size_t& length);
+
+		static bool isSpace(char32_t ch);
+
+		void use_storage();
 
 	public:
-		/** @brief Constructor. Initializes a buffer from a UTF-8 string */
+		/** @brief Constructor. Initializes a buffer over a range of UTF-8 bytes */
+		Buffer(const char* first, const char* last);
+
+		/** @brief Constructor. Initializes a buffer over a UTF-8 string */
 		Buffer(const std::string& string);
 
 		/** @brief Constructor. Initializes a buffer from a UTF-16 string */
@@ -32,17 +53,40 @@ namespace Units
 		/** @brief Constructor. Initializes a buffer from an input stream */
 		Buffer(std::istream& is);
 
+		Buffer(const Buffer&) = delete;
+		Buffer& operator=(const Buffer&) = delete;
+
 		/** @brief Destructor. */
 		~Buffer() = default;
 
 		/** @brief Constant to represent end-of-file */
-		static constexpr const char16_t EOF_MARK = std::char_traits<char16_t>::eof();
+		static constexpr const char32_t EOF_MARK = 0xFFFFFFFF;
 
 		/** @brief Returns current character. */
-		char16_t current() const;
+		char32_t current() const;
 
 		/** @brief Returns next character. */
-		char16_t ahead() const;
+		char32_t ahead() const;
+
+		/** @brief Returns the position of the current character */
+		const char* position() const { return ptr; }
+
+		/** @brief Returns where parsing first failed, or @cpp nullptr @ce */
+		const char* failure() const { return error; }
+
+		/**
+		 * @brief Record a parse failure at the given position
+		 *
+		 * Only the first failure is kept, since later ones are a consequence
+		 * of it.
+		 */
+		void fail(const char* at) { if(error == nullptr) error = at; }
+
+		/** @brief Record a parse failure caused by exceeding a @ref ParseLimits limit */
+		void failLimit(const char* at) { fail(at); limited = true; }
+
+		/** @brief Returns whether parsing stopped because a limit was exceeded */
+		bool limitExceeded() const { return limited; }
 
 		/**
 		 * @brief Push the current pointer to the stack
@@ -78,7 +122,7 @@ namespace Units
 		 *
 		 * @returns the character at the current location (before advancing)
 		 */
-		char16_t advance(bool skipws = false);
+		char32_t advance(bool skipws = false);
 
 		/** @brief Accepts an optional character.
 		 *
@@ -86,6 +130,6 @@ namespace Units
 		 * the buffer advances one character. Otherwise, @cpp false @ce is
 		 * returned and no advancement occurs.
 		 */
-		bool accept(char16_t chr);
+		bool accept(char32_t chr);
 	};
 }
@@ -0,0 +1,61 @@
+#include <cstddef>
+#include <limits>
+
+#include "Units/Units.h"
+#include "Units/Conversion.h"
+
+namespace Units
+{
+	Conversion::Conversion(const Unit& from, const Unit& to)
+		: m_Scale(1.0), m_Offset(0.0), m_Valid(true), m_Identity(true)
+	{
+		if(from == Unit::error() || to == Unit::error() || from.base_units() != to.base_units())
+		{
+			m_Scale  = std::numeric_limits<double>::quiet_NaN();
+			m_Offset = std::numeric_limits<double>::quiet_NaN();
+			m_Valid  = false;
+			m_Identity = false;
+			return;
+		}
+
+		if(from == to) return;
+
+		m_Identity = false;
+
+		// Temperature scales with an offset are the only non-linear (affine)
+		// conversions, so let convert() resolve the offset for them. Every
+		// other scale of kelvin (mK, µK...) is linear like any other unit
+		const bool offsetScale = (from == Temperature::degF || from == Temperature::degRe
+			|| to == Temperature::degF || to == Temperature::degRe);
+
+		if(from.base_units() == K.base_units() && offsetScale)
+		{
+			const Quantity zero = convert(Quantity(0.0, from), to);
+			const Quantity unit = convert(Quantity(1.0, from), to);
+
+			if(zero.unit() == Unit::error() || unit.unit() == Unit::error())
+			{
+				m_Scale  = std::numeric_limits<double>::quiet_NaN();
+				m_Offset = std::numeric_limits<double>::quiet_NaN();
+				m_Valid  = false;
+				return;
+			}
+
+			m_Scale  = unit.magnitude() - zero.magnitude();
+			m_Offset = zero.magnitude();
+			return;
+		}
+
+		m_Scale = (double)from.multiplier() / (double)to.multiplier();
+	}
+
+	void Conversion::apply(const double* first, const double* last, double* out) const
+	{
+		const size_t n = (size_t)(last - first);
+		const double scale = m_Scale;
+		const double offset = m_Offset;
+
+		for(size_t i = 0; i < n; i++)
+			out[i] = first[i] * scale + offset;
+	}
+}
@@ -0,0 +1,336 @@
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+#include "Units/CsvReader.h"
+#include "Units/Conversion.h"
+#include "Number.h"
+#include "Parser.h"
+#include "Symbols.h"
+
+namespace Units
+{
+	namespace details
+	{
+		static const double CSV_MISSING = std::numeric_limits<double>::quiet_NaN();
+
+		// Quoted cells may also contain newlines
+		static bool is_blank(char ch)
+		{
+			return ch == ' ' || ch == '\t' || ch == '\v' || ch == '\f' || ch == '\r' || ch == '\n';
+		}
+
+		static const char* trim_left(const char* first, const char* last)
+		{
+			while(first != last && is_blank(*first)) ++first;
+			return first;
+		}
+
+		static const char* trim_right(const char* first, const char* last)
+		{
+			while(last != first && is_blank(last[-1])) --last;
+			return last;
+		}
+
+		// Celsius is the same unit as kelvin, so only its symbol tells them
+		// apart. Celsius values are stored as kelvin by adding this offset
+		static double celsius_offset(const char* first, const char* last)
+		{
+			static const char symbol[] = u8"\u00B0C";
+			const size_t length = sizeof(symbol) - 1;
+
+			return ((size_t)(last - first) == length && std::memcmp(first, symbol, length) == 0 ? 273.15 : 0.0);
+		}
+	}
+
+	CsvReader::CsvReader(const CsvOptions& options)
+		: m_Delimiter(options.delimiter), m_HasHeader(false), m_Quoted(false), m_Rows(0),
+		  m_Columns(), m_ValidUnits(), m_Offsets(), m_Errors(), m_Partial(), m_Field(), m_Overrides(), m_OverrideIndex() {}
+
+	const char* CsvReader::unquote(const char* first, const char* last)
+	{
+		// Copy the contents of a quoted cell into m_Field, turning every `""`
+		// into `"`. Anything between the closing quote and the delimiter is
+		// kept as is
+		m_Field.clear();
+
+		const char* it = first + 1;
+		while(it != last)
+		{
+			const char* quote = static_cast<const char*>(std::memchr(it, '"', (size_t)(last - it)));
+			if(quote == nullptr) quote = last;
+
+			m_Field.append(it, quote);
+			it = quote;
+
+			if(it == last) break;
+
+			if(it + 1 != last && it[1] == '"')
+			{
+				m_Field += '"';
+				it += 2;
+				continue;
+			}
+
+			++it;
+			break;
+		}
+
+		const char* end = static_cast<const char*>(std::memchr(it, m_Delimiter, (size_t)(last - it)));
+		if(end == nullptr) end = last;
+
+		m_Field.append(it, end);
+		return end;
+	}
+
+	void CsvReader::header(const char* first, const char* last)
+	{
+		const char* it = first;
+
+		for(;;)
+		{
+			const char* end;
+			std::string text;
+
+			if(it != last && *it == '"')
+			{
+				end = unquote(it, last);
+				text = m_Field;
+			}
+			else
+			{
+				end = static_cast<const char*>(std::memchr(it, m_Delimiter, (size_t)(last - it)));
+				if(end == nullptr) end = last;
+
+				text.assign(it, end);
+			}
+
+			// Split `name [unit]` or `name (unit)`
+			const char* name = text.data();
+			const char* stop = details::trim_right(name, name + text.size());
+
+			Unit un;
+			bool valid = true;
+			double offset = 0.0;
+
+			if(stop != name && (stop[-1] == ']' || stop[-1] == ')'))
+			{
+				const char open = (stop[-1] == ']' ? '[' : '(');
+				const char* bracket = stop - 1;
+
+				while(bracket != name && *bracket != open) --bracket;
+
+				if(*bracket == open)
+				{
+					const char* unitFirst = details::trim_left(bracket + 1, stop - 1);
+					const char* unitLast = details::trim_right(unitFirst, stop - 1);
+
+					if(unitFirst != unitLast)
+					{
+						const char* parsed = nullptr;
+						un = details::term_to_unit(details::parse_term(unitFirst, unitLast, parsed));
+						valid = (parsed == unitLast && un != Unit::error());
+						offset = details::celsius_offset(unitFirst, unitLast);
+					}
+
+					stop = details::trim_right(name, bracket);
+				}
+			}
+
+			name = details::trim_left(name, stop);
+			m_Columns.push_back(CsvColumn{ std::string(name, stop), QuantityArray(valid ? un : Unit::error()) });
+			m_ValidUnits.push_back(valid);
+			m_Offsets.push_back(offset);
+
+			if(end == last) break;
+			it = end + 1;
+		}
+
+		m_HasHeader = true;
+	}
+
+	void CsvReader::row(const char* first, const char* last)
+	{
+		if(last != first && last[-1] == '\r') --last;
+		if(details::trim_left(first, last) == last) return;
+
+		if(!m_HasHeader)
+		{
+			header(first, last);
+			return;
+		}
+
+		size_t column = 0;
+		const char* it = first;
+
+		for(;;)
+		{
+			const char* end;
+
+			if(it != last && *it == '"')
+			{
+				end = unquote(it, last);
+				cell(column, m_Field.data(), m_Field.data() + m_Field.size());
+			}
+			else
+			{
+				end = static_cast<const char*>(std::memchr(it, m_Delimiter, (size_t)(last - it)));
+				if(end == nullptr) end = last;
+
+				cell(column, it, end);
+			}
+
+			column++;
+
+			if(end == last) break;
+			it = end + 1;
+		}
+
+		for(; column < m_Columns.size(); column++)
+		{
+			m_Columns[column].values.push_back(details::CSV_MISSING);
+			m_Errors.push_back(CsvError{ m_Rows, column });
+		}
+
+		m_Rows++;
+	}
+
+	void CsvReader::cell(size_t column, const char* first, const char* last)
+	{
+		if(column >= m_Columns.size())
+		{
+			m_Errors.push_back(CsvError{ m_Rows, column });
+			return;
+		}
+
+		QuantityArray& values = m_Columns[column].values;
+
+		double value;
+		const char* it = details::parse_number(first, last, value);
+
+		if(it == first)
+		{
+			// Empty cells are missing values, not errors
+			if(details::trim_left(first, last) != last) m_Errors.push_back(CsvError{ m_Rows, column });
+
+			values.push_back(details::CSV_MISSING);
+			return;
+		}
+
+		it = details::trim_left(it, last);
+
+		if(it != last) value = convert(column, value, it, details::trim_right(it, last));
+		else if(!m_ValidUnits[column]) value = details::CSV_MISSING;
+		else value += m_Offsets[column];
+
+		if(std::isnan(value)) m_Errors.push_back(CsvError{ m_Rows, column });
+		values.push_back(value);
+	}
+
+	double CsvReader::convert(size_t column, double value, const char* first, const char* last)
+	{
+		// Per-cell unit override. Every distinct suffix is parsed once, and
+		// found later by its hash without building a string
+		const size_t length = (size_t)(last - first);
+		const uint32_t key = details::hash(first, length);
+
+		const Override* entry = nullptr;
+		Override uncached;
+
+		auto it = m_OverrideIndex.find(key);
+		if(it != m_OverrideIndex.end() && m_Overrides[it->second].suffix.compare(0, std::string::npos, first, length) == 0)
+		{
+			entry = &m_Overrides[it->second];
+		}
+		else
+		{
+			const char* parsed = nullptr;
+			uncached.suffix.assign(first, length);
+			uncached.term = details::parse_term(first, last, parsed);
+			uncached.offset = details::celsius_offset(first, last);
+
+			if(parsed != last) uncached.term = Unit::error();
+
+			// On a hash collision the entry is used once without being cached
+			if(it == m_OverrideIndex.end())
+			{
+				m_OverrideIndex.emplace(key, m_Overrides.size());
+				m_Overrides.push_back(uncached);
+				entry = &m_Overrides.back();
+			}
+			else
+			{
+				entry = &uncached;
+			}
+		}
+
+		if(!m_ValidUnits[column] || entry->term.unit() == Unit::error()) return details::CSV_MISSING;
+
+		const Conversion conv(entry->term.unit(), m_Columns[column].values.unit());
+		if(!conv.valid()) return details::CSV_MISSING;
+
+		return conv(value * entry->term.magnitude() + entry->offset);
+	}
+
+	size_t CsvReader::feed(const char* data, size_t length)
+	{
+		const size_t before = m_Rows;
+		const char* end = data + length;
+		const char* record = data;
+		const char* scan = data;
+
+		while(scan != end)
+		{
+			const char* newline = static_cast<const char*>(std::memchr(scan, '\n', (size_t)(end - scan)));
+			const char* stop = (newline != nullptr ? newline : end);
+
+			// A newline between an odd amount of quotes belongs to a quoted
+			// cell. Escaped quotes (`""`) toggle the state twice
+			for(const char* q = scan; (q = static_cast<const char*>(std::memchr(q, '"', (size_t)(stop - q)))) != nullptr; ++q)
+				m_Quoted = !m_Quoted;
+
+			if(newline == nullptr) break;
+
+			scan = newline + 1;
+			if(m_Quoted) continue;
+
+			if(m_Partial.empty())
+			{
+				row(record, newline);
+			}
+			else
+			{
+				m_Partial.append(record, newline);
+				row(m_Partial.data(), m_Partial.data() + m_Partial.size());
+				m_Partial.clear();
+			}
+
+			record = scan;
+		}
+
+		// Carry the unfinished row over to the next chunk
+		m_Partial.append(record, end);
+		return m_Rows - before;
+	}
+
+	size_t CsvReader::finish()
+	{
+		const size_t before = m_Rows;
+
+		if(!m_Partial.empty()) row(m_Partial.data(), m_Partial.data() + m_Partial.size());
+
+		m_Partial.clear();
+		m_Quoted = false;
+
+		return m_Rows - before;
+	}
+
+	void CsvReader::clear()
+	{
+		for(CsvColumn& column : m_Columns)
+			column.values.clear();
+
+		m_Errors.clear();
+		m_Rows = 0;
+	}
+}
@@ -0,0 +1,171 @@
+#include <cmath>
+#include <limits>
+
+#include "Units/Conversion.h"
+#include "Units/Filter.h"
+
+namespace Units
+{
+	namespace details
+	{
+		// Evaluates the interval predicate for a block of (at most) 64 elements
+		template<bool LowerInclusive, bool UpperInclusive>
+		static uint64_t interval_block(const double* data, size_t n, double lower, double upper)
+		{
+			uint64_t word = 0;
+
+			for(size_t i = 0; i < n; i++)
+			{
+				const double x = data[i];
+				const bool lo = LowerInclusive ? x >= lower : x > lower;
+				const bool hi = UpperInclusive ? x <= upper : x < upper;
+				word |= (uint64_t)(lo && hi) << i;
+			}
+
+			return word;
+		}
+
+		template<bool LowerInclusive, bool UpperInclusive>
+		static void interval_mask(const double* data, size_t size, double lower, double upper, uint64_t* out)
+		{
+			for(size_t block = 0; block * 64 < size; block++)
+			{
+				const size_t begin = block * 64;
+				const size_t n = (size - begin < 64 ? size - begin : 64);
+				out[block] = interval_block<LowerInclusive, UpperInclusive>(data + begin, n, lower, upper);
+			}
+		}
+
+		static void exclude_mask(const double* data, size_t size, double lower, double upper, uint64_t* out)
+		{
+			for(size_t block = 0; block * 64 < size; block++)
+			{
+				const size_t begin = block * 64;
+				const size_t n = (size - begin < 64 ? size - begin : 64);
+
+				uint64_t word = 0;
+				for(size_t i = 0; i < n; i++)
+				{
+					const double x = data[begin + i];
+					word |= (uint64_t)(x >= lower && x <= upper) << i;
+				}
+
+				out[block] &= ~word;
+			}
+		}
+
+		static size_t popcount(uint64_t word)
+		{
+			size_t ret = 0;
+			for(; word != 0; word &= word - 1) ret++;
+			return ret;
+		}
+	}
+
+	Filter::Filter(const QuantityArray& column, Tolerance tolerance)
+		: Filter(column.data(), column.size(), column.unit(), tolerance) {}
+
+	Filter::Filter(const double* data, size_t size, Unit un, Tolerance tolerance)
+		: m_Data(data), m_Size(size), m_Unit(un), m_Tolerance(tolerance),
+		  m_Lower(-std::numeric_limits<double>::infinity()), m_Upper(std::numeric_limits<double>::infinity()),
+		  m_LowerInclusive(true), m_UpperInclusive(true), m_Empty(false), m_Excluded() {}
+
+	void Filter::restrictLower(double value, bool inclusive)
+	{
+		if(value > m_Lower || (!(value < m_Lower) && !inclusive))
+		{
+			m_Lower = value;
+			m_LowerInclusive = inclusive;
+		}
+	}
+
+	void Filter::restrictUpper(double value, bool inclusive)
+	{
+		if(value < m_Upper || (!(value > m_Upper) && !inclusive))
+		{
+			m_Upper = value;
+			m_UpperInclusive = inclusive;
+		}
+	}
+
+	Filter& Filter::where(Comparison op, const Quantity& threshold)
+	{
+		const Conversion conv(threshold.unit(), m_Unit);
+		const double value = conv(threshold.magnitude());
+
+		if(!conv.valid() || std::isnan(value))
+		{
+			m_Empty = true;
+			return *this;
+		}
+
+		// The tolerance is expressed in the unit of the threshold, so it only
+		// needs to be scaled (never offset) to the unit of the column
+		const double tol = std::fmax(m_Tolerance.absolute, m_Tolerance.relative * std::fabs(threshold.magnitude())) * std::fabs(conv.scale());
+
+		switch(op)
+		{
+			case Comparison::Less:         restrictUpper(value - tol, false); break;
+			case Comparison::LessEqual:    restrictUpper(value + tol, true ); break;
+			case Comparison::Greater:      restrictLower(value + tol, false); break;
+			case Comparison::GreaterEqual: restrictLower(value - tol, true ); break;
+
+			case Comparison::Equal:
+				restrictLower(value - tol, true);
+				restrictUpper(value + tol, true);
+				break;
+
+			case Comparison::NotEqual:
+				m_Excluded.push_back(std::make_pair(value - tol, value + tol));
+				break;
+		}
+
+		return *this;
+	}
+
+	Filter& Filter::between(const Quantity& low, const Quantity& high)
+	{
+		return where(Comparison::GreaterEqual, low).where(Comparison::LessEqual, high);
+	}
+
+	std::vector<uint64_t> Filter::mask() const
+	{
+		std::vector<uint64_t> ret((m_Size + 63) / 64, 0);
+		if(m_Empty) return ret;
+
+		/**/ if( m_LowerInclusive &&  m_UpperInclusive) details::interval_mask<true,  true >(m_Data, m_Size, m_Lower, m_Upper, ret.data());
+		else if( m_LowerInclusive && !m_UpperInclusive) details::interval_mask<true,  false>(m_Data, m_Size, m_Lower, m_Upper, ret.data());
+		else if(!m_LowerInclusive &&  m_UpperInclusive) details::interval_mask<false, true >(m_Data, m_Size, m_Lower, m_Upper, ret.data());
+		else                                            details::interval_mask<false, false>(m_Data, m_Size, m_Lower, m_Upper, ret.data());
+
+		for(const auto& ex : m_Excluded)
+			details::exclude_mask(m_Data, m_Size, ex.first, ex.second, ret.data());
+
+		return ret;
+	}
+
+	std::vector<size_t> Filter::select() const
+	{
+		const std::vector<uint64_t> bits = mask();
+		std::vector<size_t> ret;
+
+		for(size_t block = 0; block < bits.size(); block++)
+		{
+			for(uint64_t word = bits[block]; word != 0; word &= word - 1)
+			{
+				size_t bit = 0;
+				while(((word >> bit) & 1) == 0) bit++;
+				ret.push_back(block * 64 + bit);
+			}
+		}
+
+		return ret;
+	}
+
+	size_t Filter::count() const
+	{
+		size_t ret = 0;
+		for(uint64_t word : mask()) ret += details::popcount(word);
+		return ret;
+	}
+}
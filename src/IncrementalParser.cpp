@@ -0,0 +1,114 @@
+#include <cstring>
+#include <utility>
+
+#include "Units/IncrementalParser.h"
+#include "Parser.h"
+
+namespace Units
+{
+	IncrementalParser::IncrementalParser(Callback callback, const std::string& delimiters, size_t maxRecordLength)
+		: m_Callback(std::move(callback)), m_IsDelimiter(), m_SingleDelimiter('\0'), m_Partial(),
+		  m_MaxRecordLength(maxRecordLength), m_Discarding(false), m_Count(0)
+	{
+		for(char ch : delimiters)
+			if((unsigned char)ch < 0x80) m_IsDelimiter[(unsigned char)ch] = true;
+
+		if(delimiters.size() == 1) m_SingleDelimiter = delimiters[0];
+	}
+
+	void IncrementalParser::emit(const char* first, const char* last)
+	{
+		if(last != first && last[-1] == '\r') --last;
+
+		const char* it = first;
+		while(it != last && (*it == ' ' || *it == '\t' || *it == '\v' || *it == '\f')) ++it;
+		if(it == last) return;
+
+		m_Count++;
+		if(m_Callback) m_Callback(details::parse_expression(first, last));
+	}
+
+	void IncrementalParser::overflow()
+	{
+		m_Partial.clear();
+
+		m_Count++;
+		if(m_Callback) m_Callback(Quantity(Unit::error()));
+	}
+
+	size_t IncrementalParser::feed(const char* data, size_t length)
+	{
+		const size_t before = m_Count;
+		const char* record = data;
+		const char* end = data + length;
+
+		while(record != end)
+		{
+			// Find the end of the current record
+			const char* delimiter;
+
+			if(m_SingleDelimiter != '\0')
+			{
+				delimiter = static_cast<const char*>(std::memchr(record, m_SingleDelimiter, (size_t)(end - record)));
+			}
+			else
+			{
+				delimiter = record;
+				while(delimiter != end && !m_IsDelimiter[(unsigned char)*delimiter]) ++delimiter;
+				if(delimiter == end) delimiter = nullptr;
+			}
+
+			if(delimiter == nullptr)
+			{
+				if(m_Discarding) break;
+
+				// Carry the unfinished record over to the next chunk, unless
+				// it is already too long. Then it is reported right away and
+				// the rest of it is skipped
+				if((size_t)(end - record) > m_MaxRecordLength - m_Partial.size())
+				{
+					overflow();
+					m_Discarding = true;
+					break;
+				}
+
+				m_Partial.append(record, end);
+				break;
+			}
+
+			if(m_Discarding)
+			{
+				m_Discarding = false;
+			}
+			else if((size_t)(delimiter - record) > m_MaxRecordLength - m_Partial.size())
+			{
+				overflow();
+			}
+			else if(m_Partial.empty())
+			{
+				emit(record, delimiter);
+			}
+			else
+			{
+				m_Partial.append(record, delimiter);
+				emit(m_Partial.data(), m_Partial.data() + m_Partial.size());
+				m_Partial.clear();
+			}
+
+			record = delimiter + 1;
+		}
+
+		return m_Count - before;
+	}
+
+	size_t IncrementalParser::finish()
+	{
+		const size_t before = m_Count;
+
+		emit(m_Partial.data(), m_Partial.data() + m_Partial.size());
+		m_Partial.clear();
+		m_Discarding = false;
+
+		return m_Count - before;
+	}
+}
@@ -1,10 +1,17 @@
+#include <cmath>
 #include <istream>
-#include <unordered_map>
+#include <new>
+#include <string>
+#include <type_traits>
+#include <vector>
 
 #include "Units/Units.h"
 #include "Units/IO.h"
 #include "Units/addons/std.h"
 #include "Buffer.h"
+#include "Number.h"
+#include "Parser.h"
+#include "Symbols.h"
 
 namespace Units
 {
@@ -25,83 +32,9 @@ namespace Units
 			1 m, 1 m^2, 1 m/s, 1 m/s^2, 1 (4 cm^2), 33 Hz, 33 s^-1, 45 m / (10 s), 2 N*s
 	*/
 
-	Quantity parseExpression(Buffer& buff);
-	Quantity parseTerm(Buffer& buff);
-	Quantity parseFactor(Buffer& buff);
+	Quantity parseExpression(Buffer& buff, const ParseLimits& limits = ParseLimits());
+	Quantity parseTerm(Buffer& buff, const ParseLimits& limits = ParseLimits());
 	Quantity parseUnit(Buffer& buff);
-	double parsePrefix(Buffer& buff);
-
-	std::unordered_map<std::u16string, Unit> units
-	{
-		// Special
-		{ u"none" , none },
-		{ u"%"    , percent },
-		{ u"error", error   },
-		{ u"iflag", iflag   },
-
-		{ u""   , none },
-		{ u"m"  , m    },
-		{ u"kg" , kg   },
-		{ u"s"  , s    },
-		{ u"A"  , A    },
-		{ u"K"  , K    },
-		{ u"mol", mol  },
-		{ u"rad", rad  },
-		{ u"Cd" , Cd   },
-
-		{ u"sr"  , sr            },
-		{ u"Hz"  , Hz            },
-		{ u"N"   , N             },
-		{ u"Pa"  , Pa            },
-		{ u"J"   , J             },
-		{ u"W"   , W             },
-		{ u"C"   , C             },
-		{ u"V"   , V             },
-		{ u"F"   , F             },
-		{ u"\u2126", ohm         },
-		{ u"S"   , S             },
-		{ u"Wb"  , Wb            },
-		{ u"T"   , T             },
-		{ u"H"   , H             },
-		{ u"lm"  , lm            },
-		{ u"lx"  , lx            },
-		{ u"Bq"  , Bq            },
-		{ u"Gy"  , Gy            },
-		{ u"Sv"  , Sv            },
-		{ u"kat" , kat           },
-		{ u"$"   , currency      },
-		{ u"item", count         },
-		{ u"\u221aHz", std::sqrt(Hz) },
-
-		{ u"Np" , Log::neper },
-		{ u"B"  , Log::B     },
-		{ u"BA" , Log::BA    },
-		{ u"dB" , Log::dB    },
-		{ u"dBA", Log::dBA   },
-		{ u"dBc", Log::dBc   },
-
-		{ u"BV"       , Log::BV     },
-		{ u"BmV"      , Log::BmV    },
-		{ u"B\u00B5V" , Log::BuV    },
-		{ u"B\u03BCV" , Log::BuV    },
-		{ u"BuV"      , Log::BuV    },
-		{ u"B10nV"    , Log::B10nV  },
-		{ u"BW"       , Log::BW     },
-		{ u"Bk"       , Log::Bk     },
-		{ u"dBV"      , Log::dBV    },
-		{ u"dBmV"     , Log::dBmV   },
-		{ u"dB\u00B5V", Log::dBuV   },
-		{ u"dB\u03BCV", Log::dBuV   },
-		{ u"dBuV"     , Log::dBuV   },
-		{ u"dB10nV"   , Log::dB10nV },
-		{ u"dBW"      , Log::dBW    },
-		{ u"dBk"      , Log::dBk    },
-		{ u"dBm"      , Log::dBm    },
-
-		{ u"h",  Time::hour  },
-		{ u"Eh", Energy::hartree },
-		{ u"mi", i::mile }
-	};
 
 	bool isLetter(const Buffer& buff)
 	{
@@ -128,8 +61,8 @@ namespace Units
 	{
 		/**/ if(buff.current() == u'\u2070') return 0;
 		else if(buff.current() == u'\u00B9') return 1;
-		else if(buff.current() >= u'\u00B2' && buff.current() <= u'\u00B3') return buff.current() - u'\u00B0';
-		else if(buff.current() >= u'\u2074' && buff.current() <= u'\u2079') return buff.current() - u'\u2070';
+		else if(buff.current() >= u'\u00B2' && buff.current() <= u'\u00B3') return (int)(buff.current() - u'\u00B0');
+		else if(buff.current() >= u'\u2074' && buff.current() <= u'\u2079') return (int)(buff.current() - u'\u2070');
 
 		return 0;
 	}
@@ -146,80 +79,162 @@ namespace Units
 
 		while(isSuperscript(buff))
 		{
-			ret = 10 * ret + superscript2int(buff);
+			// Saturate instead of overflowing on absurdly long exponents
+			if(ret < 100000) ret = 10 * ret + superscript2int(buff);
 			buff.advance();
 		}
 
 		return neg ? -ret : ret;
 	}
 
-	Quantity parseExpression(Buffer& buff)
+	Quantity parseExpression(Buffer& buff, const ParseLimits& limits)
 	{
 		if(isSpace(buff)) buff.advance(true);
 
 		double quant = buff.parseDouble();
-		Quantity term = parseTerm(buff);
+		Quantity term = parseTerm(buff, limits);
 		return quant * term;
 	}
 
-	Quantity parseTerm(Buffer& buff)
+	// Term of an enclosing expression, waiting for a parenthesized factor
+	struct PendingTerm
 	{
-		if(isSpace(buff)) buff.advance(true);
+		Quantity term;
+		double value;
+		bool first;
+		bool divide;
+	};
+
+	// Stack of pending terms. The first levels live on the call stack (left
+	// uninitialized until used), so the heap is only used for deeply nested
+	// parentheses
+	class TermStack
+	{
+	private:
+		static constexpr size_t INLINE_DEPTH = 32;
+
+		static_assert(std::is_trivially_destructible<PendingTerm>::value, "Pending terms are never destroyed");
+
+		typename std::aligned_storage<sizeof(PendingTerm), alignof(PendingTerm)>::type m_Inline[INLINE_DEPTH];
+		std::vector<PendingTerm> m_Spill;
+		size_t m_Size;
+
+	public:
+		TermStack() : m_Spill(), m_Size(0) {}
 
-		Quantity factor = parseFactor(buff);
+		size_t size() const { return m_Size; }
+		bool empty() const { return m_Size == 0; }
 
-		while( buff.current() == ' '
-			|| buff.current() == '*'
-			|| buff.current() == '.'
-			|| buff.current() == '/'
-			|| buff.current() == '(')
+		void push(const PendingTerm& term)
 		{
-			switch(buff.current())
-			{
-				case ' ':
-				case '*':
-				case '.':
-				case '(':
-					if(buff.advance(true) != '(' && !isLetter(buff)) continue;
-					factor *= parseFactor(buff);
-					break;
+			if(m_Size < INLINE_DEPTH) new (&m_Inline[m_Size]) PendingTerm(term);
+			else m_Spill.push_back(term);
 
-				case '/':
-					if(buff.advance(true) != '(' && !isLetter(buff)) continue;
-					factor /= parseFactor(buff);
-					break;
-			}
+			m_Size++;
 		}
 
-		return factor;
-	}
-
-	Quantity parseFactor(Buffer& buff)
-	{
-		if(buff.accept('('))
+		PendingTerm pop()
 		{
-			Quantity expr = parseExpression(buff);
-			if(!buff.accept(')')) return Unit::error();
+			m_Size--;
+			if(m_Size < INLINE_DEPTH) return *reinterpret_cast<const PendingTerm*>(&m_Inline[m_Size]);
 
-			return expr.magnitude() == 0.0 ? 1.0 * expr.unit() : expr;
+			const PendingTerm ret = m_Spill.back();
+			m_Spill.pop_back();
+			return ret;
 		}
+	};
 
-		buff.push();
-		Quantity unit = parseUnit(buff);
+	Quantity parseTerm(Buffer& buff, const ParseLimits& limits)
+	{
+		// `factor` recurses into `expression` through parentheses. Instead of
+		// recursing, the enclosing terms are saved on an explicit stack, so
+		// deeply nested input cannot overflow the call stack. The buffer only
+		// moves forward, so parsing takes linear time
+		TermStack stack;
+
+		Quantity term;
+		double value = 0.0;  // Number in front of the current parenthesized expression
+		bool first = true;   // Whether the current term has no factors yet
+		bool divide = false; // Operator before the next factor
 
-		if(unit == Unit::error())
+		if(isSpace(buff)) buff.advance(true);
+
+		for(;;)
 		{
-			buff.pop();
-			return parsePrefix(buff) * parseUnit(buff);
-		}
+			if(buff.accept('('))
+			{
+				if(stack.size() >= limits.max_depth)
+				{
+					buff.failLimit(buff.position());
+					return Unit::error();
+				}
+
+				stack.push(PendingTerm{ term, value, first, divide });
+
+				// Start the nested expression: value, then term
+				if(isSpace(buff)) buff.advance(true);
+				value = buff.parseDouble();
+				if(isSpace(buff)) buff.advance(true);
+
+				first = true;
+				divide = false;
+				continue;
+			}
+
+			Quantity factor = parseUnit(buff);
+
+			for(;;)
+			{
+				/**/ if(first)  term  = factor;
+				else if(divide) term /= factor;
+				else            term *= factor;
+
+				first = false;
+
+				bool next = false;
+				while( buff.current() == ' '
+					|| buff.current() == '*'
+					|| buff.current() == '.'
+					|| buff.current() == '/'
+					|| buff.current() == '(')
+				{
+					const bool slash = (buff.current() == '/');
+					if(buff.advance(true) != '(' && !isLetter(buff)) continue;
 
-		return unit;
+					divide = slash;
+					next = true;
+					break;
+				}
+
+				if(next) break;
+				if(stack.empty()) return term;
+
+				// End of a parenthesized expression, which becomes a factor
+				// of the enclosing term
+				const Quantity expr = value * term;
+
+				if(!buff.accept(')'))
+				{
+					buff.fail(buff.position());
+					factor = Unit::error();
+				}
+				else
+				{
+					factor = (expr.magnitude() == 0.0 ? 1.0 * expr.unit() : expr);
+				}
+
+				const PendingTerm outer = stack.pop();
+				term = outer.term;
+				value = outer.value;
+				first = outer.first;
+				divide = outer.divide;
+			}
+		}
 	}
 
 	Quantity parseUnit(Buffer& buff)
 	{
-		Quantity ret = Unit::error();
-		std::u16string unitName;
+		const char* name = buff.position();
 
 		while(isLetter(buff)
 			|| buff.current() == '$'
@@ -227,70 +242,90 @@ namespace Units
 			|| buff.current() == u'\u221A'  // Square root symbol
 			|| buff.current() == u'\u2126'  // Ohm symbol
 			|| buff.current() == u'\u00B5'  // Micro symbol
+			|| buff.current() == u'\u00B0'  // Degree symbol
 			|| buff.current() == u'\u03BC') // Greek mu symbol
 		{
-			unitName += buff.current();
 			buff.advance();
 		}
 
-		// Exception: kg is the only SI unit with prefix
-		if(unitName == u"g") return g;
-
-		auto it = units.find(unitName);
-		if(it != units.end()) ret = Quantity(1.0, it->second);
-
-		if(ret != Unit::error())
+		// The symbol is resolved (prefix included) without scanning it again
+		double prefix;
+		Unit un;
+		if(!details::resolve_unit(name, (size_t)(buff.position() - name), prefix, un))
 		{
-			if(buff.accept('^'))
-				ret ^= buff.parseInt();
-			else if(buff.current() == u'\u207A' || buff.current() == u'\u207B' || isSuperscript(buff))
-				ret ^= parseExponent(buff);
+			buff.fail(name);
+			return Unit::error();
 		}
 
+		Quantity ret(prefix, un);
+
+		if(buff.accept('^'))
+			ret ^= buff.parseInt();
+		else if(buff.current() == u'\u207A' || buff.current() == u'\u207B' || isSuperscript(buff))
+			ret ^= parseExponent(buff);
+
 		return ret;
 	}
 
-	double parsePrefix(Buffer& buff)
+	namespace details
 	{
-		switch(buff.current())
+		static const char* skip_spaces(const char* first, const char* last)
+		{
+			while(first != last && (*first == ' ' || *first == '\t' || *first == '\n' || *first == '\v' || *first == '\f' || *first == '\r')) ++first;
+			return first;
+		}
+
+		Quantity parse_expression(const char* first, const char* last)
+		{
+			Buffer buff(first, last);
+			return parseExpression(buff);
+		}
+
+		Quantity parse_term(const char* first, const char* last)
+		{
+			Buffer buff(first, last);
+			return parseTerm(buff);
+		}
+
+		Quantity parse_term(const char* first, const char* last, const char*& end)
 		{
-			case u'Y': buff.advance(); return yotta;
-			case u'Z': buff.advance(); return zetta;
-			case u'E': buff.advance(); return exa;
-			case u'P': buff.advance(); return peta;
-			case u'T': buff.advance(); return tera;
-			case u'G': buff.advance(); return giga;
-			case u'M': buff.advance(); return mega;
-			case u'k': buff.advance(); return kilo;
-			case u'h': buff.advance(); return hecto;
-			case u'c': buff.advance(); return centi;
-			case u'm': buff.advance(); return milli;
-			case u'n': buff.advance(); return nano;
-			case u'p': buff.advance(); return pico;
-			case u'f': buff.advance(); return femto;
-			case u'a': buff.advance(); return atto;
-			case u'z': buff.advance(); return zepto;
-			case u'y': buff.advance(); return yocto;
-
-			// Special cases
-			case u'u':
-			case u'\u00B5':
-			case u'\u03BC':
-				buff.advance();
-				return micro;
+			Buffer buff(first, last);
+			const Quantity ret = parseTerm(buff);
+
+			end = buff.position();
+			return (buff.failure() != nullptr ? Quantity(Unit::error()) : ret);
 		}
 
-		if(buff.accept(u'd'))
-			return buff.accept(u'a') ? deca : deci;
+		ParseResult parse_term(const char* first, const char* last, Quantity& term, const ParseLimits& limits)
+		{
+			if((size_t)(last - first) > limits.max_length) return { first + limits.max_length, std::errc::value_too_large };
+
+			Buffer buff(first, last);
+			const Quantity ret = parseTerm(buff, limits);
 
-		return 1.0;
+			if(buff.limitExceeded()) return { buff.failure(), std::errc::value_too_large };
+			if(buff.failure() != nullptr) return { buff.failure(), std::errc::invalid_argument };
+			if(ret.unit() == Unit::error()) return { buff.position(), std::errc::invalid_argument };
+
+			const char* end = skip_spaces(buff.position(), last);
+			if(end != last) return { end, std::errc::invalid_argument };
+
+			term = ret;
+			return { end, std::errc() };
+		}
+
+		Unit term_to_unit(const Quantity& term)
+		{
+			// Prefixes are parsed as magnitudes and become part of the unit
+			return term.unit() == Unit::error() ? Unit::error() : Unit(term.magnitude(), term.unit());
+		}
 	}
 
 	template<typename InputType>
 	Unit to_unit_template(InputType& str)
 	{
 		Buffer buff(str);
-		return parseTerm(buff).unit();
+		return details::term_to_unit(parseTerm(buff));
 	}
 
 	template<typename InputType>
@@ -309,4 +344,259 @@ namespace Units
 	Quantity to_quantity(const std::u16string& str) { return to_quantity_template(str); }
 	Quantity to_quantity(const std::u32string& str) { return to_quantity_template(str); }
 	Quantity to_quantity(std::istream& is)          { return to_quantity_template(is); }
+
+	namespace details
+	{
+		// Whether a number overflowed: finite digits that do not fit in a
+		// double, as opposed to a literal "inf"
+		static bool out_of_range(const char* number, double value)
+		{
+			const char* digit = (*number == '+' || *number == '-') ? number + 1 : number;
+			return std::isinf(value) && (*digit == '.' || (*digit >= '0' && *digit <= '9'));
+		}
+	}
+
+	ParseResult parse_quantity(const char* first, const char* last, Quantity& out, const ParseLimits& limits)
+	{
+		if((size_t)(last - first) > limits.max_length) return { first + limits.max_length, std::errc::value_too_large };
+
+		Buffer buff(first, last);
+		if(isSpace(buff)) buff.advance(true);
+
+		const char* number = buff.position();
+		const double value = buff.parseDouble();
+		if(buff.position() == number) return { number, std::errc::invalid_argument };
+
+		if(details::out_of_range(number, value)) return { buff.position(), std::errc::result_out_of_range };
+
+		const Quantity term = parseTerm(buff, limits);
+		if(buff.limitExceeded()) return { buff.failure(), std::errc::value_too_large };
+		if(buff.failure() != nullptr) return { buff.failure(), std::errc::invalid_argument };
+		if(term.unit() == Unit::error()) return { buff.position(), std::errc::invalid_argument };
+
+		out = value * term;
+		return { buff.position(), std::errc() };
+	}
+
+	ParseResult parse_unit(const char* first, const char* last, Unit& out, const ParseLimits& limits)
+	{
+		if((size_t)(last - first) > limits.max_length) return { first + limits.max_length, std::errc::value_too_large };
+
+		Buffer buff(first, last);
+		if(isSpace(buff)) buff.advance(true);
+
+		const char* start = buff.position();
+		const Quantity term = parseTerm(buff, limits);
+
+		if(buff.limitExceeded()) return { buff.failure(), std::errc::value_too_large };
+		if(buff.failure() != nullptr) return { buff.failure(), std::errc::invalid_argument };
+		if(buff.position() == start || term.unit() == Unit::error()) return { buff.position(), std::errc::invalid_argument };
+
+		out = details::term_to_unit(term);
+		return { buff.position(), std::errc() };
+	}
+
+	namespace details
+	{
+		static bool is_digit(const char* it, const char* last) { return it != last && *it >= '0' && *it <= '9'; }
+
+		// Whether a number (as opposed to a unit) starts here: a digit, or a
+		// sign or decimal point followed by one
+		static bool starts_number(const char* it, const char* last)
+		{
+			if(it != last && (*it == '+' || *it == '-')) ++it;
+			if(it != last && *it == '.') ++it;
+
+			return is_digit(it, last);
+		}
+	}
+
+	ParseResult parse_quantity_list(const char* first, const char* last, QuantityArray& out, const ParseLimits& limits)
+	{
+		if((size_t)(last - first) > limits.max_length) return { first + limits.max_length, std::errc::value_too_large };
+
+		std::vector<double> values;
+		const char* it = details::skip_spaces(first, last);
+		const bool bracketed = (it != last && *it == '[');
+
+		if(bracketed)
+		{
+			it = details::skip_spaces(it + 1, last);
+
+			// Elements are separated by commas or whitespace
+			while(it != last && *it != ']')
+			{
+				double value;
+				const char* end = details::parse_number(it, last, value);
+				if(end == it) return { it, std::errc::invalid_argument };
+				if(details::out_of_range(it, value)) return { end, std::errc::result_out_of_range };
+
+				values.push_back(value);
+				it = details::skip_spaces(end, last);
+
+				if(it != last && *it == ',')
+				{
+					it = details::skip_spaces(it + 1, last);
+					if(!details::starts_number(it, last)) return { it, std::errc::invalid_argument };
+				}
+			}
+
+			if(it == last) return { it, std::errc::invalid_argument };
+			++it;
+		}
+		else
+		{
+			// Elements are separated by whitespace, and the first thing that
+			// is not a number starts the unit
+			if(!details::starts_number(it, last)) return { it, std::errc::invalid_argument };
+
+			for(;;)
+			{
+				double value;
+				const char* end = details::parse_number(it, last, value);
+				if(details::out_of_range(it, value)) return { end, std::errc::result_out_of_range };
+
+				values.push_back(value);
+				it = end;
+
+				const char* next = details::skip_spaces(it, last);
+				if(next == it || !details::starts_number(next, last)) break;
+
+				it = next;
+			}
+		}
+
+		Buffer buff(it, last);
+		const Quantity term = parseTerm(buff, limits);
+
+		if(buff.limitExceeded()) return { buff.failure(), std::errc::value_too_large };
+		if(buff.failure() != nullptr) return { buff.failure(), std::errc::invalid_argument };
+		if(term.unit() == Unit::error()) return { buff.position(), std::errc::invalid_argument };
+
+		// Fold the prefixes of the unit into the magnitudes, like to_quantity() does
+		const double scale = term.magnitude();
+		for(double& value : values)
+			value *= scale;
+
+		out = QuantityArray(std::move(values), term.unit());
+		return { buff.position(), std::errc() };
+	}
+
+	QuantityArray to_quantity_array(const std::string& str)
+	{
+		QuantityArray ret;
+		if(parse_quantity_list(str.data(), str.data() + str.size(), ret).ec != std::errc()) return QuantityArray(Unit::error());
+
+		return ret;
+	}
+}
+
+namespace
+{
+	using traits = std::istream::traits_type;
+
+	bool isLetter(int ch) { return (ch >= 'a' && ch <= 'z') || (ch >= 'A' && ch <= 'Z'); }
+	bool isDigit (int ch) { return ch >= '0' && ch <= '9'; }
+
+	// Appends the current character to the token, returns the next one
+	int take(std::streambuf* sb, std::string& token, int ch)
+	{
+		token += traits::to_char_type(ch);
+		return sb->snextc();
+	}
+
+	int lexNumber(std::streambuf* sb, std::string& token, int ch)
+	{
+		if(ch == '+' || ch == '-') ch = take(sb, token, ch);
+		while(isDigit(ch) || ch == '.') ch = take(sb, token, ch);
+
+		if(ch == 'e' || ch == 'E')
+		{
+			ch = take(sb, token, ch);
+			if(ch == '+' || ch == '-') ch = take(sb, token, ch);
+			while(isDigit(ch)) ch = take(sb, token, ch);
+		}
+
+		return ch;
+	}
+
+	int lexTerm(std::streambuf* sb, std::string& token, int ch)
+	{
+		int depth = 0;
+
+		while(ch != traits::eof())
+		{
+			// Every non-ASCII byte is taken: it is part of a symbol (µ, Ω...) or a superscript
+			if(isLetter(ch) || ch >= 0x80 || ch == '$' || ch == '%'
+				|| ch == ' ' || ch == '\t' || ch == '*' || ch == '.' || ch == '/')
+			{
+				ch = take(sb, token, ch);
+			}
+			else if(ch == '^')
+			{
+				ch = take(sb, token, ch);
+				if(ch == '+' || ch == '-') ch = take(sb, token, ch);
+				while(isDigit(ch)) ch = take(sb, token, ch);
+			}
+			else if(ch == '(')
+			{
+				depth++;
+				ch = take(sb, token, ch);
+			}
+			else if(depth > 0 && ch == ')')
+			{
+				depth--;
+				ch = take(sb, token, ch);
+			}
+			else if(depth > 0 && (isDigit(ch) || ch == '+' || ch == '-'))
+			{
+				ch = lexNumber(sb, token, ch);
+			}
+			else
+			{
+				// A digit outside parentheses starts the next quantity
+				break;
+			}
+		}
+
+		return ch;
+	}
+}
+
+std::istream& operator>>(std::istream& is, Units::Quantity& q)
+{
+	std::istream::sentry sentry(is);
+	if(!sentry) return is;
+
+	std::streambuf* sb = is.rdbuf();
+	std::string token;
+
+	const int ch = lexTerm(sb, token, lexNumber(sb, token, sb->sgetc()));
+	q = Units::details::parse_expression(token.data(), token.data() + token.size());
+
+	std::ios_base::iostate state = std::ios_base::goodbit;
+	if(ch == traits::eof()) state |= std::ios_base::eofbit;
+	if(token.empty() || q.unit() == Units::Unit::error()) state |= std::ios_base::failbit;
+
+	is.setstate(state);
+	return is;
+}
+
+std::istream& operator>>(std::istream& is, Units::Unit& u)
+{
+	std::istream::sentry sentry(is);
+	if(!sentry) return is;
+
+	std::streambuf* sb = is.rdbuf();
+	std::string token;
+
+	const int ch = lexTerm(sb, token, sb->sgetc());
+	u = Units::details::term_to_unit(Units::details::parse_term(token.data(), token.data() + token.size()));
+
+	std::ios_base::iostate state = std::ios_base::goodbit;
+	if(ch == traits::eof()) state |= std::ios_base::eofbit;
+	if(token.empty() || u == Units::Unit::error()) state |= std::ios_base::failbit;
+
+	is.setstate(state);
+	return is;
 }
@@ -0,0 +1,324 @@
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <unordered_map>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "Units/Loader.h"
+#include "Number.h"
+#include "Parser.h"
+#include "Symbols.h"
+#include "Tasks.h"
+
+namespace Units
+{
+	namespace details
+	{
+		// Read-only memory mapping of a whole file
+		class MappedFile
+		{
+		private:
+			const char* m_Data;
+			size_t m_Size;
+			bool m_Ok;
+#ifdef _WIN32
+			HANDLE m_File;
+			HANDLE m_Mapping;
+#endif
+
+		public:
+			explicit MappedFile(const std::string& path)
+				: m_Data(nullptr), m_Size(0), m_Ok(false)
+#ifdef _WIN32
+				, m_File(INVALID_HANDLE_VALUE), m_Mapping(nullptr)
+#endif
+			{
+#ifdef _WIN32
+				m_File = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+				if(m_File == INVALID_HANDLE_VALUE) return;
+
+				LARGE_INTEGER size;
+				if(!GetFileSizeEx(m_File, &size)) return;
+
+				m_Size = (size_t)size.QuadPart;
+				m_Ok = true;
+				if(m_Size == 0) return;
+
+				m_Mapping = CreateFileMappingA(m_File, nullptr, PAGE_READONLY, 0, 0, nullptr);
+				if(m_Mapping != nullptr) m_Data = static_cast<const char*>(MapViewOfFile(m_Mapping, FILE_MAP_READ, 0, 0, 0));
+				m_Ok = (m_Data != nullptr);
+#else
+				const int fd = open(path.c_str(), O_RDONLY);
+				if(fd < 0) return;
+
+				struct stat info;
+				if(fstat(fd, &info) == 0)
+				{
+					m_Size = (size_t)info.st_size;
+					m_Ok = true;
+
+					if(m_Size != 0)
+					{
+						void* data = mmap(nullptr, m_Size, PROT_READ, MAP_PRIVATE, fd, 0);
+						m_Ok = (data != MAP_FAILED);
+
+						if(m_Ok)
+						{
+							m_Data = static_cast<const char*>(data);
+							madvise(data, m_Size, MADV_SEQUENTIAL);
+						}
+					}
+				}
+
+				close(fd);
+#endif
+			}
+
+			~MappedFile()
+			{
+#ifdef _WIN32
+				if(m_Data != nullptr) UnmapViewOfFile(m_Data);
+				if(m_Mapping != nullptr) CloseHandle(m_Mapping);
+				if(m_File != INVALID_HANDLE_VALUE) CloseHandle(m_File);
+#else
+				if(m_Data != nullptr) munmap(const_cast<char*>(m_Data), m_Size);
+#endif
+			}
+
+			MappedFile(const MappedFile&) = delete;
+			MappedFile& operator=(const MappedFile&) = delete;
+
+			bool ok() const { return m_Ok; }
+			const char* data() const { return m_Data; }
+			size_t size() const { return (m_Data != nullptr ? m_Size : 0); }
+		};
+
+		// Column of a single chunk, with chunk-relative line numbers
+		struct ChunkColumn
+		{
+			Unit unit;
+			std::vector<double> values;
+			std::vector<size_t> lines;
+		};
+
+		struct ChunkResult
+		{
+			std::vector<ChunkColumn> columns;
+			std::vector<LoadError> errors;
+			size_t lines = 0;
+		};
+
+		static uint64_t unit_key(const Unit& un)
+		{
+			const float multiplier = un.multiplier();
+			uint32_t bits;
+			std::memcpy(&bits, &multiplier, sizeof(bits));
+
+			return ((uint64_t)un.base_units() << 32) | bits;
+		}
+
+		static bool is_blank(const char* first, const char* last)
+		{
+			for(; first != last; ++first)
+				if(*first != ' ' && *first != '\t' && *first != '\v' && *first != '\f') return false;
+
+			return true;
+		}
+
+		// Unit suffix already seen in a chunk, and the column its quantities
+		// go to (or SIZE_MAX if the suffix is invalid)
+		struct ChunkTerm
+		{
+			std::string suffix;
+			Quantity term;
+			size_t column;
+		};
+
+		static void parse_chunk(const char* base, const char* first, const char* last, ChunkResult& out)
+		{
+			// Most inputs only use a few distinct units, so each unit suffix is
+			// parsed once per chunk. Suffixes are found by their hash, without
+			// building a string for every line
+			std::vector<ChunkTerm> terms;
+			std::unordered_map<uint32_t, size_t> termIndex;
+			std::unordered_map<uint64_t, size_t> columns;
+
+			const char* line = first;
+			while(line != last)
+			{
+				const char* newline = static_cast<const char*>(std::memchr(line, '\n', (size_t)(last - line)));
+				const char* end = (newline != nullptr ? newline : last);
+				const char* stop = (end != line && end[-1] == '\r' ? end - 1 : end);
+
+				const size_t lineNumber = ++out.lines;
+
+				double magnitude;
+				const char* suffix = parse_number(line, stop, magnitude);
+				const size_t length = (size_t)(stop - suffix);
+
+				if(suffix == line)
+				{
+					if(!is_blank(line, stop)) out.errors.push_back(LoadError{ lineNumber, (size_t)(line - base) });
+
+					line = (newline != nullptr ? newline + 1 : last);
+					continue;
+				}
+
+				const uint32_t h = hash(suffix, length);
+				auto it = termIndex.find(h);
+
+				const ChunkTerm* entry = nullptr;
+				ChunkTerm uncached;
+
+				if(it != termIndex.end() && terms[it->second].suffix.compare(0, std::string::npos, suffix, length) == 0)
+				{
+					entry = &terms[it->second];
+				}
+				else
+				{
+					// Resolve the column of a new suffix. On a hash collision
+					// the entry is used once without being cached
+					uncached.suffix.assign(suffix, length);
+					uncached.term = parse_term(suffix, stop);
+					uncached.column = SIZE_MAX;
+
+					if(uncached.term.unit() != Unit::error())
+					{
+						const Unit un = uncached.term.unit();
+
+						auto col = columns.find(unit_key(un));
+						if(col == columns.end())
+						{
+							col = columns.emplace(unit_key(un), out.columns.size()).first;
+							out.columns.push_back(ChunkColumn{ un, std::vector<double>(), std::vector<size_t>() });
+						}
+
+						uncached.column = col->second;
+					}
+
+					if(it == termIndex.end())
+					{
+						termIndex.emplace(h, terms.size());
+						terms.push_back(uncached);
+						entry = &terms.back();
+					}
+					else
+					{
+						entry = &uncached;
+					}
+				}
+
+				if(entry->column == SIZE_MAX)
+				{
+					out.errors.push_back(LoadError{ lineNumber, (size_t)(line - base) });
+				}
+				else
+				{
+					ChunkColumn& column = out.columns[entry->column];
+					column.values.push_back(magnitude * entry->term.magnitude());
+					column.lines.push_back(lineNumber);
+				}
+
+				line = (newline != nullptr ? newline + 1 : last);
+			}
+		}
+	}
+
+	LoadResult parse_quantities(const char* first, const char* last, const LoadOptions& options)
+	{
+		// Split the input into chunks that end right after a newline
+		std::vector<const char*> bounds(1, first);
+		const size_t chunk = (options.chunk_size == 0 ? 1 : options.chunk_size);
+
+		while(bounds.back() != last)
+		{
+			const char* begin = bounds.back();
+			const char* end = ((size_t)(last - begin) > chunk ? begin + chunk : last);
+
+			if(end != last)
+			{
+				const char* newline = static_cast<const char*>(std::memchr(end, '\n', (size_t)(last - end)));
+				end = (newline != nullptr ? newline + 1 : last);
+			}
+
+			bounds.push_back(end);
+		}
+
+		const size_t chunks = bounds.size() - 1;
+		std::vector<details::ChunkResult> partials(chunks);
+
+		details::run_tasks(chunks, details::worker_count(options.threads, chunks), [&](size_t i) {
+			details::parse_chunk(first, bounds[i], bounds[i + 1], partials[i]);
+		});
+
+		// Merge the chunks in input order, turning chunk-relative line
+		// numbers into absolute ones
+		LoadResult ret;
+		ret.lines = 0;
+		ret.ok = true;
+
+		std::vector<details::ChunkColumn> merged;
+		std::unordered_map<uint64_t, size_t> index;
+
+		for(details::ChunkResult& partial : partials)
+		{
+			for(details::ChunkColumn& column : partial.columns)
+			{
+				const uint64_t key = details::unit_key(column.unit);
+
+				auto it = index.find(key);
+				if(it == index.end())
+				{
+					it = index.emplace(key, merged.size()).first;
+					merged.push_back(details::ChunkColumn{ column.unit, std::vector<double>(), std::vector<size_t>() });
+				}
+
+				details::ChunkColumn& target = merged[it->second];
+				target.values.insert(target.values.end(), column.values.begin(), column.values.end());
+
+				for(size_t line : column.lines)
+					target.lines.push_back(line + ret.lines);
+			}
+
+			for(const LoadError& chunkError : partial.errors)
+			{
+				ret.errors.push_back(chunkError);
+				ret.errors.back().line += ret.lines;
+			}
+
+			ret.lines += partial.lines;
+		}
+
+		ret.columns.reserve(merged.size());
+		for(details::ChunkColumn& column : merged)
+			ret.columns.push_back(QuantityColumn{ QuantityArray(std::move(column.values), column.unit), std::move(column.lines) });
+
+		return ret;
+	}
+
+	LoadResult load_quantities(const std::string& path, const LoadOptions& options)
+	{
+		const details::MappedFile file(path);
+
+		if(!file.ok())
+		{
+			LoadResult ret;
+			ret.lines = 0;
+			ret.ok = false;
+			return ret;
+		}
+
+		return parse_quantities(file.data(), file.data() + file.size(), options);
+	}
+}
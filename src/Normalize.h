@@ -0,0 +1,77 @@
+#pragma once
+
+#include <cstddef>
+#include <cstring>
+
+#include "Units/Conversion.h"
+#include "Units/Quantity.h"
+
+namespace Units
+{
+	/** @brief Size of the blocks used by @ref for_each_block() */
+	constexpr size_t NORMALIZE_BLOCK = 256;
+
+	/**
+	 * @brief Normalize a range of quantities in blocks
+	 *
+	 * Converts every quantity to the given unit and calls `fn(const double*,
+	 * size_t)` for every block of (at most) @ref NORMALIZE_BLOCK converted
+	 * magnitudes, without allocating. Conversions are resolved once per unit
+	 * and kept in a tiny cache, since ranges usually mix a handful of units.
+	 *
+	 * @returns @cpp false @ce as soon as a quantity has dimensions that are
+	 * not compatible with the given unit
+	 */
+	template<typename Function>
+	bool for_each_block(const Quantity* first, const Quantity* last, const Unit& target, Function fn)
+	{
+		constexpr size_t CACHE_SIZE = 4;
+
+		double block[NORMALIZE_BLOCK];
+
+		Unit units[CACHE_SIZE] = { target, target, target, target };
+		Conversion conversions[CACHE_SIZE];
+		size_t next = 0;
+
+		Unit current = target;
+		Conversion conv;
+
+		while(first != last)
+		{
+			size_t n = 0;
+
+			for(; first != last && n < NORMALIZE_BLOCK; ++first, ++n)
+			{
+				const Unit un = first->unit();
+
+				// Comparing the raw representation is much cheaper than
+				// Unit::operator==, and a false mismatch only costs resolving
+				// an identical conversion again
+				if(std::memcmp(&un, &current, sizeof(Unit)) != 0)
+				{
+					size_t slot = 0;
+					while(slot < CACHE_SIZE && std::memcmp(&un, &units[slot], sizeof(Unit)) != 0) slot++;
+
+					if(slot == CACHE_SIZE)
+					{
+						slot = next;
+						next = (next + 1) % CACHE_SIZE;
+
+						units[slot] = un;
+						conversions[slot] = Conversion(un, target);
+						if(!conversions[slot].valid()) return false;
+					}
+
+					current = un;
+					conv = conversions[slot];
+				}
+
+				block[n] = conv(first->magnitude());
+			}
+
+			fn(static_cast<const double*>(block), n);
+		}
+
+		return true;
+	}
+}
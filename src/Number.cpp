@@ -0,0 +1,253 @@
+#include <clocale>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+
+#include "Number.h"
+
+namespace Units
+{
+	namespace details
+	{
+		// Every power of ten up to 1e22 is exactly representable as a double
+		static const double powers_of_ten[] =
+		{
+			1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+			1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+		};
+
+		static constexpr uint64_t MAX_EXACT_MANTISSA = 1ULL << 53;
+		static constexpr int MAX_SIGNIFICANT_DIGITS = 19;
+		static constexpr size_t STACK_BUFFER_SIZE = 64;
+
+		// Halfway points between two doubles have at most 767 significant
+		// digits, so any further digit can only break ties
+		static constexpr int MAX_ROUNDING_DIGITS = 768;
+
+		static bool is_digit(char ch) { return ch >= '0' && ch <= '9'; }
+
+		static bool is_space(char ch)
+		{
+			return ch == ' '  || ch == '\t'
+				|| ch == '\n' || ch == '\v'
+				|| ch == '\f' || ch == '\r';
+		}
+
+		// Calls strtod() on a copy of a short range (shorter than the stack
+		// buffer) in which `.` is replaced by the decimal separator of the
+		// current locale. Returns the amount of consumed characters
+		static size_t localized_strtod(const char* first, const char* last, double& value)
+		{
+			const char* point = std::localeconv()->decimal_point;
+			const char separator = (point != nullptr && point[0] != '\0' && point[1] == '\0') ? point[0] : '.';
+
+			const size_t n = (size_t)(last - first);
+			char copy[STACK_BUFFER_SIZE];
+
+			for(size_t i = 0; i < n; i++)
+				copy[i] = (first[i] == '.' ? separator : (first[i] == separator ? '\0' : first[i]));
+
+			copy[n] = '\0';
+
+			char* end = nullptr;
+			value = strtod(copy, &end);
+			return (size_t)(end - copy);
+		}
+
+		// Calls strtod() on a normalized copy of a decimal number: an integer
+		// mantissa (without a decimal point, so the locale does not matter)
+		// and an exponent. Digits past MAX_ROUNDING_DIGITS are folded into a
+		// single sticky digit, which keeps the rounding exact, so the copy
+		// always fits on the stack regardless of the length of the number
+		static void compact_strtod(const char* first, const char* last, double& value)
+		{
+			char copy[MAX_ROUNDING_DIGITS + 32];
+			char* out = copy;
+
+			const char* it = first;
+			if(*it == '+' || *it == '-') *out++ = *it++;
+
+			int digits = 0;
+			long exponent = 0;
+			bool fraction = false;
+			bool sticky = false;
+
+			for(; it != last && (is_digit(*it) || *it == '.'); ++it)
+			{
+				if(*it == '.')
+				{
+					fraction = true;
+				}
+				else if(digits == 0 && *it == '0')
+				{
+					if(fraction) exponent--;
+				}
+				else if(digits < MAX_ROUNDING_DIGITS)
+				{
+					*out++ = *it;
+					digits++;
+					if(fraction) exponent--;
+				}
+				else
+				{
+					sticky = sticky || (*it != '0');
+					if(!fraction) exponent++;
+				}
+			}
+
+			if(digits == 0) *out++ = '0';
+
+			if(sticky)
+			{
+				*out++ = '1';
+				exponent--;
+			}
+
+			if(it != last && (*it == 'e' || *it == 'E'))
+			{
+				bool negative = false;
+				if(++it != last && (*it == '+' || *it == '-')) negative = (*it++ == '-');
+
+				long e = 0;
+				for(; it != last && is_digit(*it); ++it)
+					if(e < 1000000) e = 10 * e + (*it - '0');
+
+				exponent += (negative ? -e : e);
+			}
+
+			// Write the exponent backwards
+			char reversed[24];
+			size_t n = 0;
+			unsigned long magnitude = (unsigned long)(exponent < 0 ? -exponent : exponent);
+
+			do { reversed[n++] = (char)('0' + magnitude % 10); magnitude /= 10; } while(magnitude != 0);
+
+			*out++ = 'e';
+			if(exponent < 0) *out++ = '-';
+			while(n != 0) *out++ = reversed[--n];
+			*out = '\0';
+
+			value = strtod(copy, nullptr);
+		}
+
+		const char* parse_number(const char* first, const char* last, double& value)
+		{
+			const char* it = first;
+			while(it != last && is_space(*it)) ++it;
+
+			const char* start = it;
+			bool negative = false;
+
+			if(it != last && (*it == '+' || *it == '-'))
+			{
+				negative = (*it == '-');
+				++it;
+			}
+
+			// Hexadecimal numbers, infinity and NaN are rare enough to be left
+			// to the C library. Their tokens are short, so only a bounded
+			// amount of characters is copied
+			const char* bounded = (last - first < (ptrdiff_t)STACK_BUFFER_SIZE ? last : first + STACK_BUFFER_SIZE - 1);
+
+			if(it != last && !is_digit(*it) && *it != '.')
+				return first + localized_strtod(first, bounded, value);
+
+			if(last - it >= 2 && it[0] == '0' && (it[1] == 'x' || it[1] == 'X'))
+				return first + localized_strtod(first, bounded, value);
+
+			uint64_t mantissa = 0;
+			int significant = 0;
+			int exponent = 0;
+			bool truncated = false;
+			bool any = false;
+
+			for(; it != last && is_digit(*it); ++it)
+			{
+				any = true;
+
+				if(significant < MAX_SIGNIFICANT_DIGITS)
+				{
+					mantissa = 10 * mantissa + (uint64_t)(*it - '0');
+					if(mantissa != 0) significant++;
+				}
+				else
+				{
+					exponent++;
+					truncated = truncated || (*it != '0');
+				}
+			}
+
+			if(it != last && *it == '.')
+			{
+				const char* fraction = it + 1;
+
+				for(; fraction != last && is_digit(*fraction); ++fraction)
+				{
+					any = true;
+
+					if(significant < MAX_SIGNIFICANT_DIGITS)
+					{
+						mantissa = 10 * mantissa + (uint64_t)(*fraction - '0');
+						if(mantissa != 0) significant++;
+						exponent--;
+					}
+					else
+					{
+						truncated = truncated || (*fraction != '0');
+					}
+				}
+
+				// A lone "." is not a number
+				if(any) it = fraction;
+			}
+
+			if(!any)
+			{
+				value = 0.0;
+				return first;
+			}
+
+			if(it != last && (*it == 'e' || *it == 'E'))
+			{
+				const char* exp = it + 1;
+				bool expNegative = false;
+
+				if(exp != last && (*exp == '+' || *exp == '-'))
+				{
+					expNegative = (*exp == '-');
+					++exp;
+				}
+
+				if(exp != last && is_digit(*exp))
+				{
+					int e = 0;
+					for(; exp != last && is_digit(*exp); ++exp)
+						if(e < 100000) e = 10 * e + (*exp - '0');
+
+					exponent += (expNegative ? -e : e);
+					it = exp;
+				}
+			}
+
+			// Clinger's fast path: both the mantissa and the power of ten are
+			// exact, so a single multiplication or division rounds correctly
+			if(!truncated && mantissa <= MAX_EXACT_MANTISSA && exponent >= -22 && exponent <= 22)
+			{
+				double ret = (double)mantissa;
+				ret = (exponent < 0 ? ret / powers_of_ten[-exponent] : ret * powers_of_ten[exponent]);
+
+				value = (negative ? -ret : ret);
+				return it;
+			}
+
+			if(!truncated && mantissa == 0)
+			{
+				value = (negative ? -0.0 : 0.0);
+				return it;
+			}
+
+			compact_strtod(start, it, value);
+			return it;
+		}
+	}
+}
@@ -0,0 +1,22 @@
+#pragma once
+
+namespace Units
+{
+	namespace details
+	{
+		/**
+		 * @brief Parse a floating-point number at the start of a range
+		 *
+		 * Accepts the same syntax as @cpp strtod() @ce (leading whitespace
+		 * included), but always uses `.` as the decimal separator regardless
+		 * of the current locale. Decimal numbers with up to 19 significant
+		 * digits and small exponents are converted exactly without calling
+		 * into the C library; everything else falls back to @cpp strtod() @ce.
+		 * The heap is never used, whatever the length of the number.
+		 *
+		 * @returns a pointer past the last consumed character, or @p first if
+		 * no number was found (in which case @p value is set to zero)
+		 */
+		const char* parse_number(const char* first, const char* last, double& value);
+	}
+}
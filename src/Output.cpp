@@ -1,11 +1,13 @@
 #include <cmath>
 #include <array>
+#include <cstring>
 #include <string>
-#include <unordered_map>
 
 #include "Units/Units.h"
 #include "Units/IO.h"
+#include "Units/Registry.h"
 #include "Units/addons/std.h"
+#include "Registry.h"
 
 namespace Units
 {
@@ -51,325 +53,85 @@ namespace Units
 
 #undef PAIR_TYPE
 
-		// TODO: Change pair with tuple, so that every tuple holds a unit, its name and a bool that tells if this unit is "SI-friendly"
-		// or not. If so, the apropriate SI prefix will be added (if nedded). If not, the number will be represented in scientific notation.
-
 		const Unit gram__ = Unit(0.001, kg);
 
-		static std::unordered_map<Unit, const char*> unit_names =
+		static bool find_unit(const RegistrySnapshot& registry, Units::Unit un, std::string& ret)
+		{
+			if(un == Unit::error()) return false;
+
+			const RegistrySnapshot::Display* display = registry.find_display(un);
+			if(display == nullptr || (display->flags & UNIT_FORMAT) == 0) return false;
+
+			ret = display->name;
+			return true;
+		}
+
+		static bool has_prefixes(const RegistrySnapshot& registry, Units::Unit un)
 		{
-			// Base SI units
-			{ none,   ""        },
-			{ m,      "m"       },
-			{ m^2,  u8"m\u00B2" },
-			{ m^3,  u8"m\u00B3" },
-			{ kg,     "kg"      },
-			{ s,      "s"       },
-			{ A,      "A"       },
-			{ K,      "K"       },
-			{ mol,    "mol"     },
-			{ rad,    "rad"     },
-			{ Cd,     "Cd"      },
-			{ gram__, "g"       },
-
-			// Derived SI units
-			{ sr,              "sr"       },
-			{ Hz,              "Hz"       },
-			{ N,               "N"        },
-			{ Pa,              "Pa"       },
-			{ J,               "J"        },
-			{ W,               "W"        },
-			{ C,               "C"        },
-			{ V,               "V"        },
-			{ F,               "F"        },
-			{ ohm,           u8"\u2126"   },
-			{ S,               "S"        },
-			{ Wb,              "Wb"       },
-			{ T,               "T"        },
-			{ H,               "H"        },
-			{ lm,              "lm"       },
-			{ lx,              "lx"       },
-			{ Bq,              "Bq"       },
-			{ Gy,              "Gy"       },
-			{ Sv,              "Sv"       },
-			{ kat,             "kat"      },
-			{ rad * W ,        "W"        },
-			{ currency,        "$"        },
-			{ count,           "count"    },
-			{ std::sqrt(Hz), u8"\u221AHz" },
-
-			{ ft, "ft" },
-
-			// CGS
-			{ CGS::erg,          "erg" },
-			{ CGS::dyn,          "dyn" },
-			{ CGS::barye,        "Ba"  },
-			{ CGS::gal,          "Gal" },
-			{ CGS::poise,        "P"   },
-			{ CGS::stokes,       "St"  },
-			{ CGS::kayser,       "K"   }, // cm^-1
-			{ CGS::oersted,      "Oe"  },
-			{ CGS::gauss,        "G"   },
-			{ CGS::debye,        "D"   },
-			{ CGS::maxwell,      "Mx"  },
-			{ CGS::biot,         "Bi"  },
-			{ CGS::gilbert,      "Gb"  },
-			{ CGS::stilb,        "sb"  },
-			{ CGS::lambert,      "Lb"  },
-			{ CGS::phot,         "ph"  },
-			{ CGS::curie,        "Ci"  },
-			{ CGS::roentgen,     "R"   },
-			{ CGS::REM,          "rem" },
-			{ CGS::RAD,          "rad" },
-			{ CGS::emu,          ""    },
-			{ CGS::langley,      ""    },
-			{ CGS::unitpole,     ""    },
-			{ CGS::statC_charge, ""    },
-			{ CGS::statC_flux,   ""    },
-
-			// GM
-			{ GM::pond,     "gf"  },
-			{ GM::hyl,      "hyl" },
-			{ GM::at,       "at"  },
-			{ GM::poncelet, "p"   },
-			{ GM::PS,       "PS"  },
-
-			// MTS
-			{ MTS::sthene,  "sn" },
-			{ MTS::pieze,   "pz" },
-			{ MTS::thermie, "th" },
-
-			// Time
-			{ Time::min,  "min"  },
-			{ Time::hour, "h"    },
-			{ Time::day,  "d"    },
-			{ Time::week, "w"    },
-			{ Time::year, "year" },
-
-			// International
-			{ i::grain,      "gr"    },
-			{ i::inch,       "in"    },
-			{ i::foot,       "ft"    },
-			{ i::yard,       "yd"    },
-			{ i::mile,       "mi"    },
-			{ i::league,     "lea"   },
-			{ i::cord,       "cd-ft" },
-			{ i::board_foot, "BDFT"  },
-			{ i::mil,        "mil"   },
-			{ i::circ_mil,   "cmil"  },
-
-			// Avoirdupois
-			{ av::dram             , "dr"    },
-			{ av::ounce            , "oz"    },
-			{ av::pound            , "lb"    },
-			{ av::hundredweight    , "cwt"   },
-			{ av::longhundredweight, "cwt"   },
-			{ av::ton              , "t"     },
-			{ av::longton          , "l. tn" },
-			{ av::stone            , "st"    },
-			{ av::poundal          , "pdl"   },
-			{ av::lbf              , "lbf"   },
-			{ av::ozf              , "ozf"   },
-			{ av::slug             , "slug"  },
-
-			// Troy
-			{ Troy::pennyweight, "dwt"  },
-			{ Troy::oz         , "oz t" },
-			{ Troy::pound      , "lb t" },
-
-			// US
-
-			// Metric
-			{ Metric::tbsp,        "tbsp"  },
-			{ Metric::tsp,         "tsp"   },
-			{ Metric::floz,        "fl oz" }, // Review: fl. Oz. is better?
-			{ Metric::cup,         "cup"   },
-			{ Metric::cup_uslegal, "cup"   },
-			{ Metric::carat,       "ct"    },
-
-			// Canada
-			{ Canada::tbsp,     "tbsp" },
-			{ Canada::tsp,      "tsp"  },
-			{ Canada::cup,      "cup"  },
-			{ Canada::cup_trad, "cup"  },
-			{ Canada::Grain::bushel_oats, "bu" },
-
-			// Australia
-			{ Australia::tbsp, "tbsp" },
-			{ Australia::tsp,  "tsp"  },
-			{ Australia::cup,  "cup"  },
-
-			// Imperial
-			// Apothecaries
-			// Nautical
-			// Japan
-
-			// Chinese
-			{ Chinese::jin,   u8"\u65A4" },
-			{ Chinese::liang, u8"\u4E24" },
-			{ Chinese::qian,  u8"\u9322" },
-			{ Chinese::li,    u8"\u91CC" },
-			{ Chinese::cun,   u8"\u5BF8" },
-			{ Chinese::chi,   u8"\u5C3A" },
-			{ Chinese::zhang, u8"\u4E08" },
-
-			// Typografic
-
-			// Distance
-			{ Distance::ly,         "ly"     },
-			{ Distance::au,         "AU"     },
-			{ Distance::au_old,     "AU"     },
-			{ Distance::angstrom, u8"\u212B" },
-			{ Distance::parsec,     "pc"     },
-			{ Distance::arpent_us,  "arpent" },
-			{ Distance::arpent_fr,  "arpent" },
-			{ Distance::xu,         "xu"     },
-
-			// Area
-			{ Area::are,     "a"  },
-			{ Area::hectare, "ha" },
-			{ Area::barn,    "b"  },
-
-			// Angle
-			{ Angle::deg,  u8"\u00B0" },
-			{ Angle::grad,   "grad"   },
-			{ Angle::brad,   "brad"   },
-			{ Angle::gon,    "gon"    },
-			{ Angle::arcmin, "'"      },
-			{ Angle::arcsec, "\""     },
-
-			// Temperature
-			{ Temperature::degC,  u8"\u00B0C"  },
-			{ Temperature::degF,  u8"\u00B0F"  },
-			{ Temperature::degR,  u8"\u00B0R"  },
-			{ Temperature::degRe, u8"\u00B0Re" },
-
-			// Pressure
-			{ Pressure::bar,     "bar"          },
-			{ Pressure::psi,   u8"lbf/in\u00B2" },
-			{ Pressure::inHg,    "inHg"         },
-			{ Pressure::mmHg,    "mmHg"         },
-			{ Pressure::torr,    "torr"         },
-			{ Pressure::inH2O, u8"inH\u2082O"   },
-			{ Pressure::mmH2O, u8"mmH\u2082O"   },
-			{ Pressure::atm,     "atm"          },
-
-			// Power
-			{ Power::hpE, "hp(E)" },
-			{ Power::hpI, "hp(I)" },
-			{ Power::hpS, "hp(S)" },
-			{ Power::hpM, "hp(M)" },
-//			{ Power::VA,  "VA"    },
-			{ Power::VAR, "VAR"   },
-
-			// Energy
-			{ Energy::Wh,        "Wh"              },
-			{ Energy::eV,        "eV"              },
-			{ Energy::cal_4 ,  u8"cal [4\u00B0C]"  },
-			{ Energy::cal_15,  u8"cal [15\u00B0C]" },
-			{ Energy::cal_20,  u8"cal [20\u00B0C]" },
-			{ Energy::cal_mean,  "cal"             },
-			{ Energy::cal_it,    "cal"             },
-			{ Energy::cal_th,    "cal"             },
-			{ Energy::btu_th,    "BTU"             },
-			{ Energy::btu_39,  u8"BTU [39\u00B0F]" },
-			{ Energy::btu_59,  u8"BTU [59\u00B0F]" },
-			{ Energy::btu_60,  u8"BTU [60\u00B0F]" },
-			{ Energy::btu_mean,  "BTU"             },
-			{ Energy::btu_it,    "BTU"             },
-			{ Energy::btu_iso,   "ISO BTU"         },
-			{ Energy::quad,      "Quad"            },
-			{ Energy::therm_us,  "Therm [US]"      },
-			{ Energy::therm_br,  "Therm [GB]"      },
-			{ Energy::therm_ec,  "Therm [ISO]"     },
-			{ Energy::ton_tnt,   "t"               },
-			{ Energy::boe,       "BOE"             },
-			{ Energy::foeb,      "FOEB"            },
-			{ Energy::hartree, u8"E\u2095"         },
-			{ Energy::tonhour, u8"ton\u2219h"      },
-
-			// Textile
-			{ Textile::tex,    "tex"    },
-			{ Textile::denier, "den"    },
-			{ Textile::span,   "span"   }, // Review
-			{ Textile::finger, "finger" }, // Review
-			{ Textile::nail,   "nail"   }, // Review
-
-			// Clinical
-			{ Clinical::pru,             "PRU"    },
-			{ Clinical::woodu,           "WU"     },
-			{ Clinical::diopter,         "dpt"    },
-			{ Clinical::prism_diopter, u8"\u0394" },
-			{ Clinical::mesh,            "mesh"   },
-			{ Clinical::charriere,       "Fr"     },
-			{ Clinical::drop,            "gt"     },
-			{ Clinical::met,             "MET"    },
-
-			// Log
-			{ Log::neper,    "Np"       },
-			{ Log::B,        "B"        },
-			{ Log::BA,       "BA"       },
-			{ Log::dB,       "dB"       },
-			{ Log::dBA,      "dBA"      },
-			{ Log::dBc,      "dBc"      },
-			{ Log::log2,     "log2"     },
-			{ Log::log10,    "log10"    },
-			{ Log::neglog10, "-log10"   },
-			{ Log::B_SPL,    "B SPL"    },
-			{ Log::dB_SPL,   "dB SPL"   },
-			{ Log::BV,       "BV"       },
-			{ Log::BmV,      "BmV"      },
-			{ Log::Bu,     u8"B\u00B5"  },
-			{ Log::BuV,    u8"B\u00B5V" },
-			{ Log::B10nV,    "B10nV"    },
-			{ Log::BW,       "BW"       },
-			{ Log::Bk,       "Bk"       },
-			{ Log::dBV,      "dBV"      },
-			{ Log::dBmV,     "dBmV"     },
-			{ Log::dBuV,     "dBuV"     },
-			{ Log::dB10nV,   "dB10nV"   },
-			{ Log::dBW,      "dBW"      },
-			{ Log::dBk,      "dBk"      },
-			{ Log::dBm,      "dBm"      },
-			{ Log::dBu,    u8"dB\u00B5" },
-
-			// Laboratory
-			{ Laboratory::svedberg, "S"   },
-			{ Laboratory::PFU,      "PFU" },
-			{ Laboratory::pH,       "pH"  },
-
-			// Data
-			{ Data::bit,    "b"      },
-			{ Data::nibble, "nibble" },
-			{ Data::byte,   "B"      },
-
-			// Computation
-			{ Computation::FLOP,  "FLOP"  },
-			{ Computation::FLOPS, "FLOPS" },
-			{ Computation::MIPS,  "MIPS"  },
-
-			// Concentrations
-			{ percent,     "%"      },
-			{ per_mille, u8"\u2030" },
-			{ bp,        u8"\u2031" },
-			{ ppm,         "ppm"    },
-			{ ppb,         "ppb"    },
-
-			// Misc
-			{ L,   "L"   },
-			{ Da,  "u"   },
-			{ rpm, "rpm" },
-
-			{ J / (kg * K), u8"J/(kg\u2219K)" },
-			{ W / (m * K),  u8"W/(m\u2219K)"  },
+			const RegistrySnapshot::Display* display = registry.find_display(un);
+			return display != nullptr && (display->flags & UNIT_PREFIX) != 0;
+		}
+
+		// Searches the registry for the best way to display a unit: as a
+		// registered name, a power of one, or a product or quotient of one
+		// and a common unit. Takes up to a couple hundred lookups
+		static std::string format_unit(const RegistrySnapshot& registry, const Unit& un)
+		{
+			std::string str;
+
+			/**/ if(find_unit(registry, un, str)) return str;
+			else if(find_unit(registry, std::sqrt(un   ), str)) return str + "²";
+			else if(find_unit(registry, std::sqrt(un^-1), str)) return str + "⁻²";
+			else if(find_unit(registry, std::cbrt(un   ), str)) return str + "³";
+			else if(find_unit(registry, std::cbrt(un^-1), str)) return str + "⁻³";
+			else if(find_unit(registry, un^-1, str)) return str + "⁻¹";
+
+			for(auto& tu : testUnits) if(find_unit(registry, un * tu.first, str)) return str + "/" + tu.second;
+			for(auto& tu : testUnits) if(find_unit(registry, un / tu.first, str)) return str + u8"\u2219" + tu.second;
+			for(auto& tu : testUnits) if(find_unit(registry, (un / tu.first)^-1, str)) return str + "⁻¹⋅" + tu.second;
+			for(auto& tu : testUnits) if(find_unit(registry, (un * tu.first)^-1, str)) return str + "⁻¹/" + tu.second;
+
+			for(auto& tu : testUnits) if(find_unit(registry, std::sqrt(un * tu.first), str)) return str + "²/" + tu.second;
+			for(auto& tu : testUnits) if(find_unit(registry, std::sqrt(un / tu.first), str)) return str + u8"²\u2219" + tu.second;
+			for(auto& tu : testUnits) if(find_unit(registry, std::cbrt(un * tu.first), str)) return str + "³/" + tu.second;
+			for(auto& tu : testUnits) if(find_unit(registry, std::cbrt(un / tu.first), str)) return str + u8"³\u2219" + tu.second;
+
+			// TODO: If unit was not found, perform conversion to SI units. For example, if km/min was not found, perform
+			// a conversion using thw raw unit (m/s) and a multiplier of 1, such that a valid unit is always displayed.
+
+			return "???"; //unit_raw(un);
+		}
+
+		// How a unit is displayed, and whether its magnitude takes prefixes
+		struct UnitFormat
+		{
+			std::string name;
+			bool prefixes;
 		};
 
-		static bool find_unit(Units::Unit un, std::string& ret)
+		// Units formatted so far are kept in the index of the snapshot, so
+		// formatting a unit again costs a few lock-free probes instead of the
+		// search of format_unit(). Units are keyed by their packed base units
+		// and multiplier, as they are compared. Registering units publishes a
+		// new snapshot, with an empty index
+		static UnitFormat unit_format(const Unit& un)
 		{
-			if(un == Unit::error()) return false;
+			const RegistryGuard guard;
+			const RegistrySnapshot& registry = guard.snapshot();
+
+			const float multiplier = un.multiplier();
+			uint32_t bits;
+			std::memcpy(&bits, &multiplier, sizeof(bits));
+
+			const uint64_t key = ((uint64_t)un.base_units() << 32) | bits;
+
+			const FormatIndex::Entry* entry = registry.formats.find(key);
+			if(entry != nullptr) return UnitFormat{ entry->name, entry->prefixes };
 
-			auto it = unit_names.find(un);
-			return (it != unit_names.end() ? ret = it->second, true : false);
+			UnitFormat format{ format_unit(registry, un), has_prefixes(registry, un) };
+			registry.formats.insert(key, format.name, format.prefixes);
+
+			return format;
 		}
 
 		constexpr const char* FORMATTED_NAN     = "N/A";
@@ -444,29 +206,7 @@ namespace Units
 		using namespace details;
 		if(un == Unit::error()) return "ERROR";
 
-		std::string str;
-
-		/**/ if(find_unit(un, str)) return str;
-		else if(find_unit(std::sqrt(un   ), str)) return str + "²";
-		else if(find_unit(std::sqrt(un^-1), str)) return str + "⁻²";
-		else if(find_unit(std::cbrt(un   ), str)) return str + "³";
-		else if(find_unit(std::cbrt(un^-1), str)) return str + "⁻³";
-		else if(find_unit(un^-1, str)) return str + "⁻¹";
-
-		for(auto& tu : testUnits) if(find_unit(un * tu.first, str)) return str + "/" + tu.second;
-		for(auto& tu : testUnits) if(find_unit(un / tu.first, str)) return str + u8"\u2219" + tu.second;
-		for(auto& tu : testUnits) if(find_unit((un / tu.first)^-1, str)) return str + "⁻¹⋅" + tu.second;
-		for(auto& tu : testUnits) if(find_unit((un * tu.first)^-1, str)) return str + "⁻¹/" + tu.second;
-
-		for(auto& tu : testUnits) if(find_unit(std::sqrt(un * tu.first), str)) return str + "²/" + tu.second;
-		for(auto& tu : testUnits) if(find_unit(std::sqrt(un / tu.first), str)) return str + u8"²\u2219" + tu.second;
-		for(auto& tu : testUnits) if(find_unit(std::cbrt(un * tu.first), str)) return str + "³/" + tu.second;
-		for(auto& tu : testUnits) if(find_unit(std::cbrt(un / tu.first), str)) return str + u8"³\u2219" + tu.second;
-
-		// TODO: If unit was not found, perform conversion to SI units. For example, if km/min was not found, perform
-		// a conversion using thw raw unit (m/s) and a multiplier of 1, such that a valid unit is always displayed.
-
-		return "???"; //unit_raw(un);
+		return unit_format(un).name;
 	}
 
 	std::string to_string(const Quantity& q)
@@ -475,13 +215,12 @@ namespace Units
 		if(q.unit() == Unit::error()) return "ERROR";
 		if(q.unit() == kg) return to_string(convert(q, gram__));
 
-		std::string ret = (q.unit().multiplier() == 1.0f
-			|| q.unit() == gram__            || q.unit() == Energy::Wh       || q.unit() == Energy::eV        || q.unit() == Pressure::bar
-			|| q.unit() == Pressure::torr    || q.unit() == Power::VAR       || q.unit() == Computation::FLOP || q.unit() == Computation::FLOPS
-			|| q.unit() == Computation::MIPS || q.unit() == Distance::parsec
+		const UnitFormat format = unit_format(q.unit());
+
+		std::string ret = (q.unit().multiplier() == 1.0f || format.prefixes
 				? magnitude_prefix(q.magnitude(), q.unit().unit_count() == 1 ? q.unit().degree() : 1)
 				: magnitude_fixed(q.magnitude()))
-				+ to_string(q.unit());
+				+ format.name;
 
 		if(ret.back() == ' ') ret.pop_back();
 
@@ -0,0 +1,110 @@
+#include <algorithm>
+#include <atomic>
+#include <limits>
+
+#include "Units/Parallel.h"
+#include "Accumulator.h"
+#include "Normalize.h"
+#include "Tasks.h"
+
+namespace Units
+{
+	namespace details
+	{
+		// Reduces the partial results pairwise, always in the same order
+		static Accumulator tree_reduce(std::vector<Accumulator>& partials)
+		{
+			if(partials.empty()) return Accumulator();
+
+			for(size_t stride = 1; stride < partials.size(); stride *= 2)
+				for(size_t i = 0; i + stride < partials.size(); i += 2 * stride)
+					partials[i].add(partials[i + stride]);
+
+			return partials[0];
+		}
+
+		// Generic reduction. `reduce(begin, end, acc)` must add the elements
+		// in [begin, end) to the accumulator and return false on error
+		template<typename Reduce>
+		static bool parallel_reduce(size_t size, const ReductionOptions& options, Reduce reduce, double& result)
+		{
+			std::atomic<bool> ok(true);
+
+			if(options.deterministic)
+			{
+				const size_t chunk = std::max<size_t>(options.chunk_size, 1);
+				const size_t chunks = (size + chunk - 1) / chunk;
+
+				std::vector<Accumulator> partials(chunks);
+				run_tasks(chunks, worker_count(options.threads, chunks), [&](size_t i) {
+					if(!reduce(i * chunk, std::min(size, (i + 1) * chunk), partials[i])) ok = false;
+				});
+
+				result = tree_reduce(partials).result();
+				return ok;
+			}
+
+			const unsigned threads = worker_count(options.threads, size / std::max<size_t>(options.chunk_size, 1));
+			const size_t slice = (size + threads - 1) / threads;
+
+			std::vector<Accumulator> partials(threads);
+			run_tasks(threads, threads, [&](size_t i) {
+				if(!reduce(std::min(size, i * slice), std::min(size, (i + 1) * slice), partials[i])) ok = false;
+			});
+
+			Accumulator total;
+			for(const Accumulator& acc : partials) total.add(acc);
+
+			result = total.result();
+			return ok;
+		}
+	}
+
+	namespace Stats
+	{
+		Quantity parallel_sum(const QuantityArray& values, const ReductionOptions& options)
+		{
+			const double* data = values.data();
+			double result = 0.0;
+
+			details::parallel_reduce(values.size(), options, [&](size_t begin, size_t end, Accumulator& acc) {
+				acc.add(data + begin, end - begin);
+				return true;
+			}, result);
+
+			return Quantity(result, values.unit());
+		}
+
+		Quantity parallel_sum(const Quantity* first, const Quantity* last, const ReductionOptions& options)
+		{
+			if(first == last) return Quantity(0.0, Unit());
+
+			const Unit target = first->unit();
+			double result = 0.0;
+
+			const bool ok = details::parallel_reduce((size_t)(last - first), options, [&](size_t begin, size_t end, Accumulator& acc) {
+				return for_each_block(first + begin, first + end, target, [&](const double* data, size_t n) { acc.add(data, n); });
+			}, result);
+
+			if(!ok) return Quantity(std::numeric_limits<double>::quiet_NaN(), Unit::error());
+			return Quantity(result, target);
+		}
+
+		Quantity parallel_mean(const QuantityArray& values, const ReductionOptions& options)
+		{
+			if(values.empty()) return Quantity(std::numeric_limits<double>::quiet_NaN(), values.unit());
+			return Quantity(parallel_sum(values, options).magnitude() / (double)values.size(), values.unit());
+		}
+
+		Quantity parallel_mean(const Quantity* first, const Quantity* last, const ReductionOptions& options)
+		{
+			if(first == last) return Quantity(std::numeric_limits<double>::quiet_NaN(), Unit());
+
+			const Quantity total = parallel_sum(first, last, options);
+			return Quantity(total.magnitude() / (double)(last - first), total.unit());
+		}
+
+		Quantity parallel_sum (const std::vector<Quantity>& values, const ReductionOptions& options) { return parallel_sum (values.data(), values.data() + values.size(), options); }
+		Quantity parallel_mean(const std::vector<Quantity>& values, const ReductionOptions& options) { return parallel_mean(values.data(), values.data() + values.size(), options); }
+	}
+}
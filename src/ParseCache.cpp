@@ -0,0 +1,175 @@
+#include <functional>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include "Units/IO.h"
+#include "Units/ParseCache.h"
+#include "Number.h"
+#include "Parser.h"
+#include "Registry.h"
+
+namespace Units
+{
+	class ParseCache::Shard
+	{
+	public:
+		struct Entry
+		{
+			std::string key;
+			Quantity term;
+			uint64_t version;
+			bool referenced;
+		};
+
+		std::mutex mutex;
+		std::unordered_map<std::string, size_t> index;
+		std::vector<Entry> entries;
+		size_t capacity = 1;
+		size_t hand = 0;
+
+		// Inserts an entry, evicting another one with the CLOCK algorithm if
+		// the shard is full. An entry computed with an older registry is
+		// updated in place. Returns whether an entry was evicted
+		bool insert(const std::string& key, const Quantity& term, uint64_t version)
+		{
+			auto it = index.find(key);
+			if(it != index.end())
+			{
+				Entry& entry = entries[it->second];
+				if(entry.version < version)
+				{
+					entry.term = term;
+					entry.version = version;
+				}
+
+				return false;
+			}
+
+			if(entries.size() < capacity)
+			{
+				index.emplace(key, entries.size());
+				entries.push_back(Entry{ key, term, version, false });
+				return false;
+			}
+
+			// Recently used entries get a second chance
+			while(entries[hand].referenced)
+			{
+				entries[hand].referenced = false;
+				hand = (hand + 1) % capacity;
+			}
+
+			index.erase(entries[hand].key);
+			entries[hand] = Entry{ key, term, version, false };
+			index.emplace(key, hand);
+
+			hand = (hand + 1) % capacity;
+			return true;
+		}
+	};
+
+	ParseCache::ParseCache(size_t capacity, size_t shards)
+		: m_Shards(), m_ShardCount(shards == 0 ? 1 : shards), m_Hits(0), m_Misses(0), m_Evictions(0)
+	{
+		const size_t perShard = (capacity + m_ShardCount - 1) / m_ShardCount;
+
+		m_Shards.reset(new Shard[m_ShardCount]);
+		for(size_t i = 0; i < m_ShardCount; i++)
+		{
+			m_Shards[i].capacity = (perShard == 0 ? 1 : perShard);
+			m_Shards[i].entries.reserve(m_Shards[i].capacity);
+		}
+	}
+
+	ParseCache::~ParseCache() = default;
+
+	Quantity ParseCache::term(const char* first, const char* last)
+	{
+		const size_t length = (size_t)(last - first);
+
+		if(length > MAX_KEY_LENGTH)
+		{
+			m_Misses.fetch_add(1, std::memory_order_relaxed);
+			return details::parse_term(first, last);
+		}
+
+		// Entries computed with an older snapshot of the registry are stale.
+		// The guard is shared with the parser, so both see the same snapshot
+		const details::RegistryGuard registry;
+		const uint64_t version = registry->version;
+
+		const std::string key(first, length);
+		Shard& shard = m_Shards[std::hash<std::string>()(key) % m_ShardCount];
+
+		{
+			std::lock_guard<std::mutex> lock(shard.mutex);
+
+			auto it = shard.index.find(key);
+			if(it != shard.index.end() && shard.entries[it->second].version == version)
+			{
+				Shard::Entry& entry = shard.entries[it->second];
+				entry.referenced = true;
+
+				m_Hits.fetch_add(1, std::memory_order_relaxed);
+				return entry.term;
+			}
+		}
+
+		// Parse without holding the lock. If another thread inserted the same
+		// string meanwhile, its result is identical (or from another snapshot,
+		// and the newest one is kept)
+		m_Misses.fetch_add(1, std::memory_order_relaxed);
+		const Quantity ret = details::parse_term(first, last);
+
+		std::lock_guard<std::mutex> lock(shard.mutex);
+		if(shard.insert(key, ret, version))
+			m_Evictions.fetch_add(1, std::memory_order_relaxed);
+
+		return ret;
+	}
+
+	Unit ParseCache::to_unit(const std::string& str)
+	{
+		return details::term_to_unit(term(str.data(), str.data() + str.size()));
+	}
+
+	Quantity ParseCache::to_quantity(const std::string& str)
+	{
+		const char* first = str.data();
+		const char* last = first + str.size();
+
+		double magnitude;
+		const char* suffix = details::parse_number(first, last, magnitude);
+		return magnitude * term(suffix, last);
+	}
+
+	size_t ParseCache::size() const
+	{
+		size_t ret = 0;
+
+		for(size_t i = 0; i < m_ShardCount; i++)
+		{
+			std::lock_guard<std::mutex> lock(m_Shards[i].mutex);
+			ret += m_Shards[i].entries.size();
+		}
+
+		return ret;
+	}
+
+	void ParseCache::clear()
+	{
+		for(size_t i = 0; i < m_ShardCount; i++)
+		{
+			std::lock_guard<std::mutex> lock(m_Shards[i].mutex);
+			m_Shards[i].index.clear();
+			m_Shards[i].entries.clear();
+			m_Shards[i].hand = 0;
+		}
+	}
+
+	ParseCache::Statistics ParseCache::statistics() const
+	{
+		return Statistics{ m_Hits.load(std::memory_order_relaxed), m_Misses.load(std::memory_order_relaxed), m_Evictions.load(std::memory_order_relaxed) };
+	}
+}
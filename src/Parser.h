@@ -0,0 +1,40 @@
+#pragma once
+
+#include "Units/Quantity.h"
+#include "Units/IO.h"
+
+namespace Units
+{
+	namespace details
+	{
+		/** @brief Parse a quantity from a range of UTF-8 bytes, like @ref Units::to_quantity() */
+		Quantity parse_expression(const char* first, const char* last);
+
+		/**
+		 * @brief Parse the unit part of a quantity from a range of UTF-8 bytes
+		 *
+		 * Returns the parsed term as a quantity, whose magnitude holds the
+		 * multiplier of any prefixes (for example, `km` is 1000 m).
+		 */
+		Quantity parse_term(const char* first, const char* last);
+
+		/**
+		 * @brief Parse the unit part of a quantity, reporting where parsing stopped
+		 *
+		 * @param[out] end  Position of the first character that was not parsed
+		 */
+		Quantity parse_term(const char* first, const char* last, const char*& end);
+
+		/**
+		 * @brief Parse the unit part of a quantity within the given limits
+		 *
+		 * Works like @ref Units::parse_unit(), but keeps the prefixes as the
+		 * magnitude of @p term. The whole range must be consumed, except for
+		 * trailing whitespace.
+		 */
+		ParseResult parse_term(const char* first, const char* last, Quantity& term, const ParseLimits& limits);
+
+		/** @brief Converts a parsed term into a unit, folding its magnitude into the multiplier */
+		Unit term_to_unit(const Quantity& term);
+	}
+}
@@ -0,0 +1,224 @@
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+
+#include "Units/QuantileSketch.h"
+
+namespace Units
+{
+	namespace details
+	{
+		static constexpr double TDIGEST_PI = 3.14159265358979323846;
+
+		// Scale function k1 of the t-digest paper and its inverse. It keeps
+		// centroids small near the tails and larger around the median
+		static double tdigest_k(double q, double compression)
+		{
+			return compression / (2.0 * TDIGEST_PI) * std::asin(2.0 * q - 1.0);
+		}
+
+		static double tdigest_q(double k, double compression)
+		{
+			return (std::sin(k * 2.0 * TDIGEST_PI / compression) + 1.0) / 2.0;
+		}
+	}
+
+	QuantileSketch::QuantileSketch(double compression)
+		: m_Compression(compression < 10.0 ? 10.0 : compression), m_Unit(), m_HasUnit(false),
+		  m_Centroids(), m_Buffer(), m_BufferCapacity((size_t)(5.0 * m_Compression)),
+		  m_Count(0.0), m_Min(std::numeric_limits<double>::infinity()), m_Max(-std::numeric_limits<double>::infinity()),
+		  m_LastUnit(), m_LastConversion()
+	{
+		m_Buffer.reserve(m_BufferCapacity);
+	}
+
+	QuantileSketch::QuantileSketch(Unit un, double compression)
+		: QuantileSketch(compression)
+	{
+		m_Unit = m_LastUnit = un;
+		m_HasUnit = true;
+	}
+
+	void QuantileSketch::add(double value, double weight)
+	{
+		m_Buffer.push_back(Centroid{ value, weight });
+		m_Count += weight;
+		m_Min = std::min(m_Min, value);
+		m_Max = std::max(m_Max, value);
+
+		if(m_Buffer.size() >= m_BufferCapacity) compress();
+	}
+
+	void QuantileSketch::compress(std::vector<Centroid>& buffer, const std::vector<Centroid>& centroids, double total, double compression, std::vector<Centroid>& out)
+	{
+		// Centroids are always kept sorted, so only the buffer needs sorting.
+		// They are copied into the buffer before clearing the output, which
+		// may be the same vector
+		const auto byMean = [](const Centroid& a, const Centroid& b) { return a.mean < b.mean; };
+		const size_t buffered = buffer.size();
+
+		std::sort(buffer.begin(), buffer.end(), byMean);
+		buffer.insert(buffer.end(), centroids.begin(), centroids.end());
+		std::inplace_merge(buffer.begin(), buffer.begin() + (std::ptrdiff_t)buffered, buffer.end(), byMean);
+
+		out.clear();
+
+		Centroid current = buffer[0];
+		double weightSoFar = 0.0;
+		double limit = total * details::tdigest_q(details::tdigest_k(0.0, compression) + 1.0, compression);
+
+		for(size_t i = 1; i < buffer.size(); i++)
+		{
+			const Centroid& next = buffer[i];
+
+			if(weightSoFar + current.weight + next.weight <= limit)
+			{
+				current.weight += next.weight;
+				current.mean += (next.mean - current.mean) * next.weight / current.weight;
+				continue;
+			}
+
+			weightSoFar += current.weight;
+			out.push_back(current);
+
+			limit = total * details::tdigest_q(details::tdigest_k(weightSoFar / total, compression) + 1.0, compression);
+			current = next;
+		}
+
+		out.push_back(current);
+		buffer.clear();
+	}
+
+	void QuantileSketch::compress()
+	{
+		if(m_Buffer.empty()) return;
+
+		compress(m_Buffer, m_Centroids, m_Count, m_Compression, m_Centroids);
+	}
+
+	bool QuantileSketch::insert(const Quantity& q)
+	{
+		if(std::isnan(q.magnitude())) return false;
+
+		if(!m_HasUnit)
+		{
+			m_Unit = m_LastUnit = q.unit();
+			m_LastConversion = Conversion();
+			m_HasUnit = true;
+		}
+		else if(q.unit() != m_LastUnit)
+		{
+			// Values usually arrive in a handful of units, so caching the
+			// last conversion avoids resolving it again for every insert
+			const Conversion conv(q.unit(), m_Unit);
+			if(!conv.valid()) return false;
+
+			m_LastUnit = q.unit();
+			m_LastConversion = conv;
+		}
+
+		add(m_LastConversion(q.magnitude()), 1.0);
+		return true;
+	}
+
+	void QuantileSketch::insert(double magnitude)
+	{
+		if(std::isnan(magnitude)) return;
+
+		m_HasUnit = true;
+		add(magnitude, 1.0);
+	}
+
+	bool QuantileSketch::merge(const QuantileSketch& other)
+	{
+		if(other.empty()) return true;
+
+		if(!m_HasUnit)
+		{
+			m_Unit = m_LastUnit = other.m_Unit;
+			m_LastConversion = Conversion();
+			m_HasUnit = true;
+		}
+
+		const Conversion conv(other.m_Unit, m_Unit);
+		if(!conv.valid()) return false;
+
+		// Copy everything before adding anything, since other may be this
+		// sketch and adding may compress it
+		std::vector<Centroid> centroids(other.m_Centroids);
+		centroids.insert(centroids.end(), other.m_Buffer.begin(), other.m_Buffer.end());
+		const double otherMin = conv(other.m_Min);
+		const double otherMax = conv(other.m_Max);
+
+		for(const Centroid& c : centroids)
+			add(conv(c.mean), c.weight);
+
+		m_Min = std::min(m_Min, otherMin);
+		m_Max = std::max(m_Max, otherMax);
+		return true;
+	}
+
+	Quantity QuantileSketch::quantile(double q) const
+	{
+		if(empty() || !(q >= 0.0 && q <= 1.0)) return Quantity(std::numeric_limits<double>::quiet_NaN(), m_Unit);
+
+		// Pending values are merged into a local copy, so that a query never
+		// modifies the sketch
+		std::vector<Centroid> merged;
+		if(!m_Buffer.empty())
+		{
+			std::vector<Centroid> buffer(m_Buffer);
+			compress(buffer, m_Centroids, m_Count, m_Compression, merged);
+		}
+
+		const std::vector<Centroid>& centroids = (m_Buffer.empty() ? m_Centroids : merged);
+		const double target = q * m_Count;
+		const size_t n = centroids.size();
+
+		if(n == 1) return Quantity(centroids[0].mean, m_Unit);
+
+		// Between the smallest value and the center of the first centroid
+		const double firstCenter = centroids[0].weight / 2.0;
+		if(target < firstCenter)
+			return Quantity(m_Min + (centroids[0].mean - m_Min) * (target / firstCenter), m_Unit);
+
+		// Between the centers of two consecutive centroids
+		double cumulative = firstCenter;
+		for(size_t i = 0; i + 1 < n; i++)
+		{
+			const double gap = (centroids[i].weight + centroids[i + 1].weight) / 2.0;
+
+			if(target < cumulative + gap)
+			{
+				const double t = (target - cumulative) / gap;
+				return Quantity(centroids[i].mean + t * (centroids[i + 1].mean - centroids[i].mean), m_Unit);
+			}
+
+			cumulative += gap;
+		}
+
+		// Between the center of the last centroid and the largest value
+		const double lastHalf = centroids[n - 1].weight / 2.0;
+		const double t = (lastHalf > 0.0 ? std::min(1.0, (target - cumulative) / lastHalf) : 1.0);
+		return Quantity(centroids[n - 1].mean + t * (m_Max - centroids[n - 1].mean), m_Unit);
+	}
+
+	Quantity QuantileSketch::quantile(double q, const Unit& un) const
+	{
+		const Conversion conv(m_Unit, un);
+		if(!conv.valid()) return Quantity(std::numeric_limits<double>::quiet_NaN(), Unit::error());
+
+		return Quantity(conv(quantile(q).magnitude()), un);
+	}
+
+	Quantity QuantileSketch::min() const
+	{
+		return Quantity(empty() ? std::numeric_limits<double>::quiet_NaN() : m_Min, m_Unit);
+	}
+
+	Quantity QuantileSketch::max() const
+	{
+		return Quantity(empty() ? std::numeric_limits<double>::quiet_NaN() : m_Max, m_Unit);
+	}
+}
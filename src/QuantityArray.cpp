@@ -0,0 +1,56 @@
+#include <utility>
+
+#include "Units/Conversion.h"
+#include "Units/QuantityArray.h"
+
+namespace Units
+{
+	QuantityArray::QuantityArray(Unit un)
+		: m_Magnitudes(), m_Unit(un) {}
+
+	QuantityArray::QuantityArray(std::vector<double> magnitudes, Unit un)
+		: m_Magnitudes(std::move(magnitudes)), m_Unit(un) {}
+
+	QuantityArray::QuantityArray(const Quantity* first, const Quantity* last)
+		: m_Magnitudes(), m_Unit(first != last ? first->unit() : Unit())
+	{
+		m_Magnitudes.reserve((size_t)(last - first));
+
+		// Consecutive quantities usually share their unit, so only resolve the
+		// conversion again when the unit changes
+		Unit current = m_Unit;
+		Conversion conv;
+
+		for(const Quantity* it = first; it != last; ++it)
+		{
+			if(it->unit() != current)
+			{
+				current = it->unit();
+				conv = Conversion(current, m_Unit);
+			}
+
+			m_Magnitudes.push_back(conv(it->magnitude()));
+		}
+	}
+
+	QuantityArray::QuantityArray(const std::vector<Quantity>& quantities)
+		: QuantityArray(quantities.data(), quantities.data() + quantities.size()) {}
+
+	void QuantityArray::push_back(const Quantity& quantity)
+	{
+		if(quantity.unit() == m_Unit)
+			m_Magnitudes.push_back(quantity.magnitude());
+		else
+			m_Magnitudes.push_back(Conversion(quantity.unit(), m_Unit)(quantity.magnitude()));
+	}
+
+	QuantityArray QuantityArray::convert(const Unit& result) const
+	{
+		const Conversion conv(m_Unit, result);
+		if(!conv.valid()) return QuantityArray(Unit::error());
+
+		QuantityArray ret(std::vector<double>(m_Magnitudes.size()), result);
+		conv.apply(data(), data() + size(), ret.data());
+		return ret;
+	}
+}
@@ -0,0 +1,158 @@
+#include <algorithm>
+#include <cmath>
+#include <utility>
+
+#include "Units/Conversion.h"
+#include "Units/QuantitySeries.h"
+
+namespace Units
+{
+	namespace details
+	{
+		// Upper bound on the samples produced by resample(), so that a tiny
+		// interval does not turn into a huge allocation
+		static const double max_resample_samples = 16777216.0;
+	}
+
+	QuantitySeries::QuantitySeries(Unit timeUnit, Unit valueUnit)
+		: m_Time(timeUnit), m_Values(valueUnit) {}
+
+	QuantitySeries::QuantitySeries(QuantityArray time, QuantityArray values)
+		: m_Time(std::move(time)), m_Values(std::move(values))
+	{
+		const size_t n = std::min(m_Time.size(), m_Values.size());
+		m_Time.resize(n);
+		m_Values.resize(n);
+	}
+
+	void QuantitySeries::reserve(size_t n)
+	{
+		m_Time.reserve(n);
+		m_Values.reserve(n);
+	}
+
+	void QuantitySeries::push_back(const Quantity& time, const Quantity& value)
+	{
+		m_Time.push_back(time);
+		m_Values.push_back(value);
+	}
+
+	QuantitySeries QuantitySeries::derivative() const
+	{
+		const size_t n = size();
+		if(n < 2) return QuantitySeries(m_Time.unit(), m_Values.unit() / m_Time.unit());
+
+		std::vector<double> time(n - 1);
+		std::vector<double> rate(n - 1);
+
+		const double* t = m_Time.data();
+		const double* v = m_Values.data();
+
+		for(size_t i = 0; i < n - 1; i++)
+		{
+			time[i] = t[i + 1];
+			rate[i] = (v[i + 1] - v[i]) / (t[i + 1] - t[i]);
+		}
+
+		return QuantitySeries(QuantityArray(std::move(time), m_Time.unit()), QuantityArray(std::move(rate), m_Values.unit() / m_Time.unit()));
+	}
+
+	QuantitySeries QuantitySeries::cumulative_integral() const
+	{
+		const size_t n = size();
+		const Unit result = m_Values.unit() * m_Time.unit();
+		if(n == 0) return QuantitySeries(m_Time.unit(), result);
+
+		std::vector<double> area(n);
+
+		const double* t = m_Time.data();
+		const double* v = m_Values.data();
+
+		// The running sum is inherently sequential, so compute the area of
+		// each trapezoid first (which vectorizes) and accumulate afterwards
+		area[0] = 0.0;
+		for(size_t i = 1; i < n; i++)
+			area[i] = 0.5 * (v[i] + v[i - 1]) * (t[i] - t[i - 1]);
+
+		for(size_t i = 1; i < n; i++)
+			area[i] += area[i - 1];
+
+		return QuantitySeries(m_Time, QuantityArray(std::move(area), result));
+	}
+
+	Quantity QuantitySeries::integral() const
+	{
+		const size_t n = size();
+		const Unit result = m_Values.unit() * m_Time.unit();
+		if(n < 2) return Quantity(0.0, result);
+
+		const double* t = m_Time.data();
+		const double* v = m_Values.data();
+
+		// Independent partial sums allow the compiler to vectorize the loop
+		// without reordering floating-point operations on its own
+		double sum[4] = { 0.0, 0.0, 0.0, 0.0 };
+		size_t i = 1;
+
+		for(; i + 3 < n; i += 4)
+		{
+			sum[0] += (v[i + 0] + v[i - 1]) * (t[i + 0] - t[i - 1]);
+			sum[1] += (v[i + 1] + v[i + 0]) * (t[i + 1] - t[i + 0]);
+			sum[2] += (v[i + 2] + v[i + 1]) * (t[i + 2] - t[i + 1]);
+			sum[3] += (v[i + 3] + v[i + 2]) * (t[i + 3] - t[i + 2]);
+		}
+
+		for(; i < n; i++)
+			sum[0] += (v[i] + v[i - 1]) * (t[i] - t[i - 1]);
+
+		return Quantity(0.5 * ((sum[0] + sum[1]) + (sum[2] + sum[3])), result);
+	}
+
+	QuantitySeries QuantitySeries::resample(const Quantity& interval) const
+	{
+		const Conversion conv(interval.unit(), m_Time.unit());
+		const double step = conv(interval.magnitude());
+
+		if(!conv.valid() || !(step > 0.0) || !std::isfinite(step) || empty())
+			return QuantitySeries(m_Time.unit(), m_Values.unit());
+
+		const size_t n = size();
+		const double* t = m_Time.data();
+		const double* v = m_Values.data();
+
+		const double start = t[0];
+		const double span = t[n - 1] - start;
+		if(!std::isfinite(start) || !std::isfinite(t[n - 1]) || !(span >= 0.0))
+			return QuantitySeries(m_Time.unit(), m_Values.unit());
+
+		const double count = std::floor(span / step) + 1.0;
+		if(!(count <= details::max_resample_samples))
+			return QuantitySeries(m_Time.unit(), m_Values.unit());
+
+		const size_t samples = (size_t)count;
+
+		std::vector<double> time(samples);
+		std::vector<double> values(samples);
+
+		size_t j = 0;
+		for(size_t k = 0; k < samples; k++)
+		{
+			const double tk = start + (double)k * step;
+			while(j + 2 < n && t[j + 1] < tk) j++;
+
+			time[k] = tk;
+
+			if(j + 1 >= n)
+			{
+				values[k] = v[j];
+				continue;
+			}
+
+			const double dt = t[j + 1] - t[j];
+			const double w = (dt > 0.0 ? (tk - t[j]) / dt : 0.0);
+			values[k] = v[j] + w * (v[j + 1] - v[j]);
+		}
+
+		return QuantitySeries(QuantityArray(std::move(time), m_Time.unit()), QuantityArray(std::move(values), m_Values.unit()));
+	}
+}
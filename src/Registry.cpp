@@ -0,0 +1,336 @@
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <memory>
+#include <mutex>
+
+#include "Units/Units.h"
+#include "Units/BuiltinNames.h"
+#include "Units/Registry.h"
+#include "Registry.h"
+#include "Symbols.h"
+
+namespace Units
+{
+	namespace details
+	{
+#define UNIT_NAME(un, name) { un, name },
+
+		// Built-in names, see UNITS_BUILTIN_NAMES
+		static const std::pair<Unit, const char*> builtin_names[] =
+		{
+			UNITS_BUILTIN_NAMES(UNIT_NAME)
+		};
+
+#undef UNIT_NAME
+
+		// Units whose quantities are scaled with SI prefixes even though
+		// their multiplier is not 1
+		static const Unit prefixed_units[] =
+		{
+			gram__, Energy::Wh, Energy::eV, Pressure::bar, Pressure::torr, Power::VAR,
+			Computation::FLOP, Computation::FLOPS, Computation::MIPS, Distance::parsec
+		};
+
+		bool RegistrySnapshot::find_symbol(const char* name, size_t length, Unit& out) const
+		{
+			const uint32_t h = hash(name, length);
+
+			auto it = std::lower_bound(symbols.begin(), symbols.end(), h,
+				[](const Symbol& sym, uint32_t key) { return sym.hash < key; });
+
+			for(; it != symbols.end() && it->hash == h; ++it)
+			{
+				if(it->name.size() == length && std::memcmp(it->name.data(), name, length) == 0)
+				{
+					out = it->unit;
+					return true;
+				}
+			}
+
+			return false;
+		}
+
+		const RegistrySnapshot::Display* RegistrySnapshot::find_display(const Unit& un) const
+		{
+			auto it = display.find(un);
+			return (it != display.end() ? &it->second : nullptr);
+		}
+
+		FormatIndex::FormatIndex()
+		{
+			for(std::atomic<const Entry*>& slot : m_Slots) slot.store(nullptr, std::memory_order_relaxed);
+		}
+
+		FormatIndex::FormatIndex(const FormatIndex&) : FormatIndex() {}
+
+		FormatIndex::~FormatIndex()
+		{
+			for(std::atomic<const Entry*>& slot : m_Slots) delete slot.load(std::memory_order_relaxed);
+		}
+
+		// Linear probing from the slot of the key: entries are never removed,
+		// so the first empty slot ends the search
+		const FormatIndex::Entry* FormatIndex::find(uint64_t key) const
+		{
+			const size_t first = (size_t)((key * 0x9E3779B97F4A7C15ull) >> 54);
+
+			for(size_t i = 0; i < PROBES; i++)
+			{
+				const Entry* entry = m_Slots[(first + i) % SLOTS].load(std::memory_order_acquire);
+				if(entry == nullptr || entry->key == key) return entry;
+			}
+
+			return nullptr;
+		}
+
+		// Formatters racing on the same unit compute the same entry, so the
+		// loser just drops its copy
+		void FormatIndex::insert(uint64_t key, const std::string& name, bool prefixes) const
+		{
+			std::unique_ptr<const Entry> entry(new Entry{ key, name, prefixes });
+			const size_t first = (size_t)((key * 0x9E3779B97F4A7C15ull) >> 54);
+
+			for(size_t i = 0; i < PROBES; i++)
+			{
+				const Entry* expected = nullptr;
+				std::atomic<const Entry*>& slot = m_Slots[(first + i) % SLOTS];
+
+				if(slot.compare_exchange_strong(expected, entry.get(), std::memory_order_release, std::memory_order_acquire))
+				{
+					entry.release();
+					return;
+				}
+
+				if(expected->key == key) return;
+			}
+		}
+
+		// Symbols of the parser are looked up before the registry, so they
+		// cannot be registered to parse as anything else
+		static bool shadowed(const UnitDefinition& def)
+		{
+			double multiplier = 1.0;
+			Unit builtin;
+
+			return (def.flags & UNIT_PARSE) != 0
+				&& lookup_builtin(def.name.data(), def.name.size(), multiplier, builtin)
+				&& Unit(multiplier, builtin) != def.unit;
+		}
+
+		static bool valid(const UnitDefinition& def)
+		{
+			return !def.name.empty()
+				&& def.unit != Unit::error()
+				&& (def.flags & (UNIT_PARSE | UNIT_FORMAT | UNIT_PREFIX)) != 0
+				&& !shadowed(def);
+		}
+
+		// Adds a definition to a snapshot under construction. Built-in names
+		// never replace earlier ones, registered names always do
+		static void add(RegistrySnapshot& snapshot, const UnitDefinition& def, bool replace)
+		{
+			if((def.flags & UNIT_PARSE) != 0 && !def.name.empty())
+			{
+				auto it = std::find_if(snapshot.symbols.begin(), snapshot.symbols.end(),
+					[&def](const RegistrySnapshot::Symbol& sym) { return sym.name == def.name; });
+
+				/**/ if(it == snapshot.symbols.end()) snapshot.symbols.push_back({ hash(def.name.data(), def.name.size()), def.name, def.unit });
+				else if(replace) it->unit = def.unit;
+			}
+
+			if((def.flags & (UNIT_FORMAT | UNIT_PREFIX)) != 0)
+			{
+				auto it = snapshot.display.find(def.unit);
+
+				if(it == snapshot.display.end())
+				{
+					snapshot.display.emplace(def.unit, RegistrySnapshot::Display { def.name, def.flags });
+				}
+				else if(replace)
+				{
+					if((def.flags & UNIT_FORMAT) != 0) it->second.name = def.name;
+					it->second.flags |= def.flags;
+				}
+			}
+		}
+
+		static void sort_symbols(RegistrySnapshot& snapshot)
+		{
+			std::stable_sort(snapshot.symbols.begin(), snapshot.symbols.end(),
+				[](const RegistrySnapshot::Symbol& a, const RegistrySnapshot::Symbol& b) { return a.hash < b.hash; });
+		}
+
+		// Hazard pointer of a reader thread: the snapshot it pins, if any.
+		// Slots are never freed; a slot released by an exiting thread is
+		// reused by the next new one
+		struct ReaderSlot
+		{
+			std::atomic<const RegistrySnapshot*> pinned;
+			std::atomic<bool> used;
+			ReaderSlot* next;
+			size_t depth;
+		};
+
+		class Registry
+		{
+		private:
+			std::atomic<const RegistrySnapshot*> m_Current;
+			std::atomic<ReaderSlot*> m_Slots;
+			std::mutex m_Writers;
+			std::unique_ptr<const RegistrySnapshot> m_Latest;
+			std::vector<std::unique_ptr<const RegistrySnapshot>> m_Retired;
+
+			// Frees the retired snapshots that no reader pins anymore
+			void reclaim()
+			{
+				std::vector<const RegistrySnapshot*> pinned;
+				for(ReaderSlot* slot = m_Slots.load(std::memory_order_acquire); slot != nullptr; slot = slot->next)
+				{
+					const RegistrySnapshot* snapshot = slot->pinned.load();
+					if(snapshot != nullptr) pinned.push_back(snapshot);
+				}
+
+				m_Retired.erase(std::remove_if(m_Retired.begin(), m_Retired.end(),
+					[&pinned](const std::unique_ptr<const RegistrySnapshot>& snapshot)
+					{
+						return std::find(pinned.begin(), pinned.end(), snapshot.get()) == pinned.end();
+					}), m_Retired.end());
+			}
+
+		public:
+			Registry() : m_Current(nullptr), m_Slots(nullptr), m_Writers(), m_Latest(), m_Retired()
+			{
+				std::unique_ptr<RegistrySnapshot> snapshot(new RegistrySnapshot());
+				snapshot->version = 1;
+
+				for(const auto& entry : builtin_names)
+					add(*snapshot, UnitDefinition { entry.second, entry.first, UNIT_PARSE | UNIT_FORMAT }, false);
+
+				for(const Unit& un : prefixed_units)
+					snapshot->display[un].flags |= UNIT_PREFIX;
+
+				sort_symbols(*snapshot);
+
+				m_Current.store(snapshot.get());
+				m_Latest = std::move(snapshot);
+			}
+
+			ReaderSlot* acquire_slot()
+			{
+				for(ReaderSlot* slot = m_Slots.load(std::memory_order_acquire); slot != nullptr; slot = slot->next)
+				{
+					bool expected = false;
+					if(!slot->used.load(std::memory_order_relaxed) && slot->used.compare_exchange_strong(expected, true, std::memory_order_acquire))
+						return slot;
+				}
+
+				ReaderSlot* slot = new ReaderSlot();
+				slot->pinned.store(nullptr, std::memory_order_relaxed);
+				slot->used.store(true, std::memory_order_relaxed);
+				slot->next = m_Slots.load(std::memory_order_relaxed);
+				slot->depth = 0;
+
+				while(!m_Slots.compare_exchange_weak(slot->next, slot, std::memory_order_release, std::memory_order_relaxed));
+				return slot;
+			}
+
+			// Publishes the current snapshot in the slot, then checks that it
+			// is still current. Once that holds, writers see the pin before
+			// they can retire the snapshot
+			const RegistrySnapshot* pin(ReaderSlot& slot)
+			{
+				const RegistrySnapshot* snapshot = m_Current.load();
+
+				for(;;)
+				{
+					slot.pinned.store(snapshot);
+
+					const RegistrySnapshot* current = m_Current.load();
+					if(current == snapshot) return snapshot;
+
+					snapshot = current;
+				}
+			}
+
+			bool publish(const std::vector<UnitDefinition>& units)
+			{
+				for(const UnitDefinition& def : units)
+					if(!valid(def)) return false;
+
+				std::lock_guard<std::mutex> lock(m_Writers);
+
+				// Readers keep using the current snapshot while the next one is built
+				std::unique_ptr<RegistrySnapshot> snapshot(new RegistrySnapshot(*m_Latest));
+				snapshot->version = m_Latest->version + 1;
+
+				for(const UnitDefinition& def : units)
+					add(*snapshot, def, true);
+
+				sort_symbols(*snapshot);
+
+				m_Current.store(snapshot.get());
+				m_Retired.emplace_back(std::move(m_Latest));
+				m_Latest = std::move(snapshot);
+
+				reclaim();
+				return true;
+			}
+		};
+
+		static Registry& registry()
+		{
+			static Registry instance;
+			return instance;
+		}
+
+		// Returns the slot of the calling thread to the registry when it exits
+		struct ThreadSlot
+		{
+			ReaderSlot* slot = nullptr;
+
+			~ThreadSlot()
+			{
+				if(slot != nullptr) slot->used.store(false, std::memory_order_release);
+			}
+		};
+
+		static ReaderSlot& thread_slot()
+		{
+			static thread_local ThreadSlot local;
+			if(local.slot == nullptr) local.slot = registry().acquire_slot();
+
+			return *local.slot;
+		}
+
+		RegistryGuard::RegistryGuard()
+			: m_Slot(&thread_slot()), m_Snapshot(nullptr)
+		{
+			m_Snapshot = (m_Slot->depth++ == 0 ? registry().pin(*m_Slot) : m_Slot->pinned.load(std::memory_order_relaxed));
+		}
+
+		RegistryGuard::RegistryGuard(const RegistrySnapshot& snapshot)
+			: m_Slot(&thread_slot()), m_Snapshot(&snapshot)
+		{
+			// The other guard keeps the snapshot alive, so it can be pinned
+			// without checking that it is still current
+			if(m_Slot->depth++ == 0) m_Slot->pinned.store(m_Snapshot);
+			else m_Snapshot = m_Slot->pinned.load(std::memory_order_relaxed);
+		}
+
+		RegistryGuard::~RegistryGuard()
+		{
+			if(--m_Slot->depth == 0) m_Slot->pinned.store(nullptr, std::memory_order_release);
+		}
+	}
+
+	bool register_unit(const std::string& name, const Unit& unit, unsigned flags)
+	{
+		return register_units({ UnitDefinition { name, unit, flags } });
+	}
+
+	bool register_units(const std::vector<UnitDefinition>& units)
+	{
+		return details::registry().publish(units);
+	}
+}
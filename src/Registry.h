@@ -0,0 +1,128 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "Units/Unit.h"
+#include "Units/addons/std.h"
+
+namespace Units
+{
+	namespace details
+	{
+		/**
+		 * @brief Formats of units computed with one snapshot of the registry
+		 *
+		 * Insert-only hash table of immutable entries: readers only load
+		 * atomic pointers, and an entry is never replaced, so it lives as long
+		 * as the snapshot. A unit whose slots are all taken by other units is
+		 * not cached. Copies start out empty, since formats depend on the
+		 * names of the snapshot.
+		 */
+		class FormatIndex
+		{
+		public:
+			struct Entry
+			{
+				uint64_t key;
+				std::string name;
+				bool prefixes;
+			};
+
+			FormatIndex();
+			FormatIndex(const FormatIndex&);
+			~FormatIndex();
+
+			FormatIndex& operator=(const FormatIndex&) = delete;
+
+			/** @brief Returns the entry of a key, or @cpp nullptr @ce. Never blocks */
+			const Entry* find(uint64_t key) const;
+
+			/** @brief Stores an entry, unless the key is already stored or there is no room */
+			void insert(uint64_t key, const std::string& name, bool prefixes) const;
+
+		private:
+			static constexpr size_t SLOTS  = 1024;
+			static constexpr size_t PROBES = 8;
+
+			mutable std::atomic<const Entry*> m_Slots[SLOTS];
+		};
+
+		/** @brief Immutable snapshot of the unit registry */
+		struct RegistrySnapshot
+		{
+			struct Symbol
+			{
+				uint32_t hash;
+				std::string name;
+				Unit unit;
+			};
+
+			struct Display
+			{
+				std::string name;
+				unsigned flags;
+			};
+
+			/** @brief Increases with every published snapshot, starting at 1 */
+			uint64_t version;
+
+			/** @brief Names accepted by the parser, sorted by hash */
+			std::vector<Symbol> symbols;
+
+			/** @brief Names and flags used by the formatter */
+			std::unordered_map<Unit, Display> display;
+
+			/** @brief Units formatted so far with this snapshot, filled by the formatter */
+			FormatIndex formats;
+
+			/** @brief Look up a name (UTF-8) without allocating */
+			bool find_symbol(const char* name, size_t length, Unit& out) const;
+
+			/** @brief Returns the display entry of a unit, or @cpp nullptr @ce */
+			const Display* find_display(const Unit& un) const;
+		};
+
+		struct ReaderSlot;
+
+		/**
+		 * @brief Pins the current snapshot of the registry
+		 *
+		 * Never blocks. The snapshot stays valid while the guard is alive,
+		 * even after newer ones are published; once no guard pins it, the
+		 * next writer frees it. Guards nested on the same thread share the
+		 * snapshot of the outermost one.
+		 */
+		class RegistryGuard
+		{
+		private:
+			ReaderSlot* m_Slot;
+			const RegistrySnapshot* m_Snapshot;
+
+		public:
+			RegistryGuard();
+
+			/**
+			 * @brief Pins a snapshot held by a guard of another thread
+			 *
+			 * Lets worker threads share the snapshot of the thread that
+			 * started them, whose guard must outlive this one. If this thread
+			 * already pins a snapshot, that one is kept, like for nested
+			 * guards.
+			 */
+			explicit RegistryGuard(const RegistrySnapshot& snapshot);
+
+			~RegistryGuard();
+
+			RegistryGuard(const RegistryGuard&) = delete;
+			RegistryGuard& operator=(const RegistryGuard&) = delete;
+
+			const RegistrySnapshot& snapshot() const { return *m_Snapshot; }
+			const RegistrySnapshot* operator->() const { return m_Snapshot; }
+		};
+	}
+}
@@ -0,0 +1,346 @@
+#include <cstdint>
+#include <cstring>
+#include <string>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define UNITS_SCANNER_SSE2
+#include <emmintrin.h>
+#endif
+
+#include "Units/Scanner.h"
+#include "Number.h"
+#include "Parser.h"
+#include "Symbols.h"
+
+namespace Units
+{
+	namespace details
+	{
+		static bool is_digit(unsigned char ch) { return (unsigned char)(ch - '0') < 10; }
+
+		static bool is_alpha(unsigned char ch) { return (unsigned char)((ch | 0x20) - 'a') < 26; }
+
+		// Characters that make a digit part of a word or of a longer number
+		static bool is_word(unsigned char ch)
+		{
+			return is_alpha(ch) || is_digit(ch) || ch == '_' || ch == '.' || ch >= 0x80;
+		}
+
+		// Characters that may appear in a unit. Bytes of multi-byte UTF-8
+		// sequences (`µ`, `Ω`, `°`, superscripts...) are accepted as they are
+		// and left for the parser to validate
+		static bool is_unit(unsigned char ch)
+		{
+			return is_alpha(ch) || ch >= 0x80 || ch == '/' || ch == '*' || ch == '^' || ch == '%' || ch == '$';
+		}
+
+#ifndef UNITS_SCANNER_SSE2
+		// Characters that may follow a number that has a unit: the unit itself,
+		// the space before it, or the fraction or exponent of the number
+		static bool is_follow(unsigned char ch)
+		{
+			return is_alpha(ch) || ch >= 0x80 || ch == ' ' || ch == '.' || ch == '%' || ch == '$';
+		}
+#endif
+
+		// Digits, word characters and characters that may follow a number, in
+		// a 64-byte block, one bit per byte
+		struct BlockMasks
+		{
+			uint64_t digits;
+			uint64_t words;
+			uint64_t follows;
+		};
+
+		static BlockMasks classify(const char* block)
+		{
+			BlockMasks ret = { 0, 0, 0 };
+
+#ifdef UNITS_SCANNER_SSE2
+			// SSE2 has no unsigned comparison: ranges are tested by biasing the
+			// bytes by 0x80, so that `ch - lo < n` becomes a signed comparison
+			const __m128i bias = _mm_set1_epi8((char)0x80);
+			const __m128i zero = _mm_set1_epi8('0');
+			const __m128i digitLimit = _mm_set1_epi8((char)(0x80 + 10));
+			const __m128i lowerA = _mm_set1_epi8('a');
+			const __m128i alphaLimit = _mm_set1_epi8((char)(0x80 + 26));
+			const __m128i caseBit = _mm_set1_epi8(0x20);
+			const __m128i underscore = _mm_set1_epi8('_');
+			const __m128i dot = _mm_set1_epi8('.');
+			const __m128i space = _mm_set1_epi8(' ');
+			const __m128i percent = _mm_set1_epi8('%');
+			const __m128i dollar = _mm_set1_epi8('$');
+
+			for(int i = 0; i < 4; i++)
+			{
+				const __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(block + 16 * i));
+				const __m128i digit = _mm_cmplt_epi8(_mm_xor_si128(_mm_sub_epi8(bytes, zero), bias), digitLimit);
+				const __m128i alpha = _mm_cmplt_epi8(_mm_xor_si128(_mm_sub_epi8(_mm_or_si128(bytes, caseBit), lowerA), bias), alphaLimit);
+				const __m128i isDot = _mm_cmpeq_epi8(bytes, dot);
+				const __m128i symbol = _mm_or_si128(_mm_cmpeq_epi8(bytes, percent), _mm_cmpeq_epi8(bytes, dollar));
+
+				// Bytes >= 0x80 already have their high bit set
+				const __m128i letter = _mm_or_si128(alpha, bytes);
+				const __m128i word = _mm_or_si128(_mm_or_si128(digit, letter), _mm_or_si128(isDot, _mm_cmpeq_epi8(bytes, underscore)));
+				const __m128i follow = _mm_or_si128(_mm_or_si128(letter, isDot), _mm_or_si128(symbol, _mm_cmpeq_epi8(bytes, space)));
+
+				ret.digits |= (uint64_t)(uint32_t)_mm_movemask_epi8(digit) << (16 * i);
+				ret.words |= (uint64_t)(uint32_t)_mm_movemask_epi8(word) << (16 * i);
+				ret.follows |= (uint64_t)(uint32_t)_mm_movemask_epi8(follow) << (16 * i);
+			}
+#else
+			for(int i = 0; i < 64; i++)
+			{
+				const unsigned char ch = (unsigned char)block[i];
+				ret.digits |= (uint64_t)is_digit(ch) << i;
+				ret.words |= (uint64_t)is_word(ch) << i;
+				ret.follows |= (uint64_t)is_follow(ch) << i;
+			}
+#endif
+
+			return ret;
+		}
+
+		// Index of the lowest set bit of a non-zero word
+		static int lowest_bit(uint64_t word)
+		{
+#if defined(__GNUC__) || defined(__clang__)
+			return __builtin_ctzll(word);
+#else
+			int ret = 0;
+			while((word & 1) == 0) { word >>= 1; ret++; }
+			return ret;
+#endif
+		}
+
+		// Unit text already seen, with its parsed term
+		struct ScanTerm
+		{
+			std::string text;
+			uint32_t hash;
+			bool valid;
+			Quantity term;
+		};
+
+		// Open-addressed table of the unit texts seen so far, so each one is
+		// checked against the whitelist and parsed only once
+		class TermCache
+		{
+		private:
+			const std::vector<std::string>& m_Whitelist;
+			std::vector<ScanTerm> m_Terms;
+			std::vector<uint32_t> m_Slots; // Index + 1 of a term, or 0 if empty
+
+			bool allowed(const char* first, size_t length) const
+			{
+				if(m_Whitelist.empty()) return true;
+
+				for(const std::string& unit : m_Whitelist)
+					if(unit.compare(0, std::string::npos, first, length) == 0) return true;
+
+				return false;
+			}
+
+			void insert(uint32_t index)
+			{
+				const size_t mask = m_Slots.size() - 1;
+				size_t slot = m_Terms[index].hash & mask;
+
+				while(m_Slots[slot] != 0) slot = (slot + 1) & mask;
+				m_Slots[slot] = index + 1;
+			}
+
+		public:
+			explicit TermCache(const std::vector<std::string>& whitelist) : m_Whitelist(whitelist), m_Terms(), m_Slots(64, 0) {}
+
+			/** @brief Look up a unit text. Returns @cpp false @ce if it is invalid or not whitelisted */
+			bool find(const char* first, const char* last, Quantity& term)
+			{
+				const size_t length = (size_t)(last - first);
+				const uint32_t h = hash(first, length);
+				const size_t mask = m_Slots.size() - 1;
+
+				for(size_t slot = h & mask; m_Slots[slot] != 0; slot = (slot + 1) & mask)
+				{
+					const ScanTerm& entry = m_Terms[m_Slots[slot] - 1];
+
+					if(entry.hash == h && entry.text.compare(0, std::string::npos, first, length) == 0)
+					{
+						term = entry.term;
+						return entry.valid;
+					}
+				}
+
+				ScanTerm entry{ std::string(first, length), h, false, Quantity(Unit::error()) };
+				if(allowed(first, length))
+				{
+					const char* end = nullptr;
+					entry.term = parse_term(first, last, end);
+					entry.valid = (end == last && entry.term.unit() != Unit::error());
+				}
+
+				term = entry.term;
+				m_Terms.push_back(entry);
+
+				// Keep the table at most half full
+				if(2 * m_Terms.size() > m_Slots.size())
+				{
+					m_Slots.assign(2 * m_Slots.size(), 0);
+					for(size_t i = 0; i < m_Terms.size(); i++) insert((uint32_t)i);
+				}
+				else
+				{
+					insert((uint32_t)(m_Terms.size() - 1));
+				}
+
+				return entry.valid;
+			}
+		};
+
+		// Find the end of the decimal number that starts at `first`, without
+		// converting it: digits, an optional fraction and an optional exponent
+		static const char* skip_number(const char* first, const char* last)
+		{
+			const char* it = first;
+			while(it != last && is_digit((unsigned char)*it)) ++it;
+
+			if(it != last && *it == '.')
+			{
+				++it;
+				while(it != last && is_digit((unsigned char)*it)) ++it;
+			}
+
+			if(it != last && (*it | 0x20) == 'e')
+			{
+				const char* exp = it + 1;
+				if(exp != last && (*exp == '-' || *exp == '+')) ++exp;
+
+				if(exp != last && is_digit((unsigned char)*exp))
+				{
+					while(exp != last && is_digit((unsigned char)*exp)) ++exp;
+					it = exp;
+				}
+			}
+
+			return it;
+		}
+
+		// Find the end of the unit that starts at `first`. Digits are only
+		// allowed in exponents (`m^2`, `s^-1`), and operators are never
+		// trailing (the `/` in `5 m/ 2` is not part of the unit)
+		static const char* lex_unit(const char* first, const char* last)
+		{
+			const char* it = first;
+
+			while(it != last)
+			{
+				const unsigned char ch = (unsigned char)*it;
+
+				if(ch == '^')
+				{
+					const char* exp = it + 1;
+					if(exp != last && (*exp == '-' || *exp == '+')) ++exp;
+					if(exp == last || !is_digit((unsigned char)*exp)) break;
+
+					while(exp != last && is_digit((unsigned char)*exp)) ++exp;
+					it = exp;
+				}
+				else if(is_unit(ch))
+				{
+					++it;
+				}
+				else
+				{
+					break;
+				}
+			}
+
+			while(it != first && (it[-1] == '/' || it[-1] == '*'))
+				--it;
+
+			return it;
+		}
+	}
+
+	std::vector<QuantityMatch> scan_quantities(const char* first, const char* last, const ScanOptions& options)
+	{
+		std::vector<QuantityMatch> matches;
+		details::TermCache terms(options.units);
+
+		// Where scanning resumes after a candidate, so the digits inside a
+		// number or a unit (`m^2`) are not scanned again
+		const char* resume = first;
+		uint64_t carry = 0;
+
+		for(const char* block = first; block < last; block += 64)
+		{
+			// The last partial block is classified from a zero-padded copy
+			char padded[64];
+			const char* bytes = block;
+
+			if(last - block < 64)
+			{
+				std::memset(padded, 0, sizeof(padded));
+				std::memcpy(padded, block, (size_t)(last - block));
+				bytes = padded;
+			}
+
+			// Numbers start at a digit that is not part of a word (`x86`) or
+			// of a longer number (the `3` in `1.2.3`)
+			const details::BlockMasks masks = details::classify(bytes);
+			uint64_t starts = masks.digits & ~((masks.words << 1) | carry);
+			carry = masks.words >> 63;
+
+			// Digit runs followed by a character that cannot come after a
+			// number with a unit (`2021-05-04`, `10:00`) are skipped here. Runs
+			// that reach the end of the block are always checked
+			const uint64_t ends = masks.digits & ~(masks.digits >> 1);
+			const uint64_t candidates = ends & ((masks.follows >> 1) | (1ull << 63));
+
+			for(; starts != 0; starts &= starts - 1)
+			{
+				const int bit = details::lowest_bit(starts);
+				if(((candidates >> details::lowest_bit(ends & (~0ull << bit))) & 1) == 0) continue;
+
+				const char* it = block + bit;
+				if(it < resume) continue;
+
+				// Digit groups after a comma (`1,000` or the decimal comma of
+				// `3,5`) are not numbers of their own. Reading them alone would
+				// turn `1,000 ms` into `000 ms`, so the whole number is skipped
+				if(it - first >= 2 && it[-1] == ',' && details::is_digit((unsigned char)it[-2])) continue;
+
+				const char* start = it;
+				if(start != first && (start[-1] == '-' || start[-1] == '+')
+					&& (start - 1 == first || !details::is_word((unsigned char)start[-2])))
+					--start;
+
+				// Decimal numbers only: `0x1F` is an identifier, not hexadecimal
+				if(it[0] == '0' && it + 1 != last && (it[1] | 0x20) == 'x')
+				{
+					resume = it + 2;
+					continue;
+				}
+
+				// Most numbers in a text are not followed by a unit, so they are
+				// only converted once their unit is known to be valid
+				const char* number = details::skip_number(it, last);
+				const char* unit = (number != last && *number == ' ' ? number + 1 : number);
+				const char* end = details::lex_unit(unit, last);
+				resume = number;
+
+				if(end == unit || (end != last && details::is_digit((unsigned char)*end))) continue;
+
+				Quantity term;
+				double value;
+				if(terms.find(unit, end, term) && details::parse_number(start, number, value) == number)
+				{
+					matches.push_back(QuantityMatch{ (size_t)(start - first), (size_t)(end - start), Quantity(value * term.magnitude(), term.unit()) });
+					resume = end;
+				}
+			}
+		}
+
+		return matches;
+	}
+}
@@ -0,0 +1,184 @@
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <utility>
+
+#include "Units/Units.h"
+#include "Units/Conversion.h"
+#include "Units/Sort.h"
+
+namespace Units
+{
+	namespace details
+	{
+		using SortKey = std::pair<uint64_t, size_t>;
+
+		// Maps a double to an unsigned integer with the same ordering. NaN is
+		// mapped above +infinity
+		static uint64_t ordered_bits(double value)
+		{
+			if(std::isnan(value)) return UINT64_MAX;
+
+			uint64_t bits;
+			std::memcpy(&bits, &value, sizeof(bits));
+			return (bits & 0x8000000000000000ULL) ? ~bits : (bits | 0x8000000000000000ULL);
+		}
+
+		// Builds the SI-normalized keys of a range. Returns false if the
+		// quantities do not share the same dimensions
+		static bool build_keys(const Quantity* first, const Quantity* last, std::vector<SortKey>& keys)
+		{
+			const size_t n = (size_t)(last - first);
+			keys.resize(n);
+			if(n == 0) return true;
+
+			const UnitData::BaseUnitType base = first->unit().base_units();
+			for(const Quantity* it = first; it != last; ++it)
+				if(it->unit().base_units() != base) return false;
+
+			// Temperatures need an offset to be normalized, everything else is
+			// just scaled by the multiplier of its unit
+			const bool affine = (base == K.base_units());
+
+			Unit current = first->unit();
+			double scale = (double)current.multiplier();
+			Conversion conv = (affine ? Conversion(current, K) : Conversion());
+
+			for(size_t i = 0; i < n; i++)
+			{
+				if(first[i].unit() != current)
+				{
+					current = first[i].unit();
+					scale = (double)current.multiplier();
+					if(affine) conv = Conversion(current, K);
+				}
+
+				const double key = (affine ? conv(first[i].magnitude()) : first[i].magnitude() * scale);
+				keys[i] = SortKey(ordered_bits(key), i);
+			}
+
+			return true;
+		}
+
+		// LSD radix sort on 16-bit digits. Passes in which every key shares
+		// the same digit are skipped
+		static void radix_sort(std::vector<SortKey>& keys)
+		{
+			const size_t n = keys.size();
+			if(n < 256)
+			{
+				std::stable_sort(keys.begin(), keys.end(), [](const SortKey& a, const SortKey& b) { return a.first < b.first; });
+				return;
+			}
+
+			std::vector<size_t> histogram(4 * 65536, 0);
+			for(const SortKey& key : keys)
+				for(int pass = 0; pass < 4; pass++)
+					histogram[(size_t)pass * 65536 + ((key.first >> (16 * pass)) & 0xFFFF)]++;
+
+			std::vector<SortKey> buffer(n);
+
+			for(int pass = 0; pass < 4; pass++)
+			{
+				size_t* offsets = &histogram[(size_t)pass * 65536];
+				if(offsets[(keys[0].first >> (16 * pass)) & 0xFFFF] == n) continue;
+
+				size_t offset = 0;
+				for(size_t digit = 0; digit < 65536; digit++)
+				{
+					const size_t c = offsets[digit];
+					offsets[digit] = offset;
+					offset += c;
+				}
+
+				for(const SortKey& key : keys)
+					buffer[offsets[(key.first >> (16 * pass)) & 0xFFFF]++] = key;
+
+				keys.swap(buffer);
+			}
+		}
+
+		static void permute(Quantity* first, const std::vector<SortKey>& keys)
+		{
+			std::vector<Quantity> sorted;
+			sorted.reserve(keys.size());
+
+			for(const SortKey& key : keys)
+				sorted.push_back(first[key.second]);
+
+			std::copy(sorted.begin(), sorted.end(), first);
+		}
+	}
+
+	bool sort(Quantity* first, Quantity* last)
+	{
+		std::vector<details::SortKey> keys;
+		if(!details::build_keys(first, last, keys)) return false;
+
+		details::radix_sort(keys);
+		details::permute(first, keys);
+		return true;
+	}
+
+	bool sort(std::vector<Quantity>& values)
+	{
+		return sort(values.data(), values.data() + values.size());
+	}
+
+	bool stable_sort(Quantity* first, Quantity* last)
+	{
+		return sort(first, last);
+	}
+
+	bool stable_sort(std::vector<Quantity>& values)
+	{
+		return sort(values);
+	}
+
+	bool nth_element(Quantity* first, Quantity* nth, Quantity* last)
+	{
+		std::vector<details::SortKey> keys;
+		if(!details::build_keys(first, last, keys)) return false;
+		if(nth == last) return true;
+
+		std::nth_element(keys.begin(), keys.begin() + (nth - first), keys.end(),
+			[](const details::SortKey& a, const details::SortKey& b) { return a.first < b.first; });
+
+		details::permute(first, keys);
+		return true;
+	}
+
+	bool nth_element(std::vector<Quantity>& values, size_t nth)
+	{
+		return nth_element(values.data(), values.data() + std::min(nth, values.size()), values.data() + values.size());
+	}
+
+	std::vector<Quantity> top_k(const Quantity* first, const Quantity* last, size_t k)
+	{
+		std::vector<details::SortKey> keys;
+		if(!details::build_keys(first, last, keys)) return std::vector<Quantity>();
+
+		// Rank NaN below everything else
+		for(details::SortKey& key : keys)
+			if(key.first == UINT64_MAX) key.first = 0;
+
+		k = std::min(k, keys.size());
+		std::partial_sort(keys.begin(), keys.begin() + (ptrdiff_t)k, keys.end(),
+			[](const details::SortKey& a, const details::SortKey& b) { return a.first > b.first || (a.first == b.first && a.second < b.second); });
+
+		std::vector<Quantity> ret;
+		ret.reserve(k);
+
+		for(size_t i = 0; i < k; i++)
+			ret.push_back(first[keys[i].second]);
+
+		return ret;
+	}
+
+	std::vector<Quantity> top_k(const std::vector<Quantity>& values, size_t k)
+	{
+		return top_k(values.data(), values.data() + values.size(), k);
+	}
+}
@@ -0,0 +1,115 @@
+#include <cstring>
+
+#include "Units/Units.h"
+#include "Units/BuiltinNames.h"
+#include "Registry.h"
+#include "Symbols.h"
+
+namespace Units
+{
+	namespace details
+	{
+		static bool match(const char* name, size_t length, const char* symbol, const Unit& un, Unit& out)
+		{
+			if(std::strlen(symbol) != length || std::memcmp(name, symbol, length) != 0) return false;
+
+			out = un;
+			return true;
+		}
+
+#define UNIT_SYMBOL(symbol, un) case hash(symbol): return match(name, length, symbol, un, out);
+
+		bool lookup_unit(const char* name, size_t length, Unit& out)
+		{
+			switch(hash(name, length))
+			{
+				UNITS_BUILTIN_SYMBOLS(UNIT_SYMBOL)
+			}
+
+			return false;
+		}
+
+#undef UNIT_SYMBOL
+
+		double lookup_prefix(const char* name, size_t length, size_t& prefixLength)
+		{
+			prefixLength = 0;
+			if(length == 0) return 1.0;
+
+			prefixLength = 1;
+
+			switch(name[0])
+			{
+				case 'Y': return yotta;
+				case 'Z': return zetta;
+				case 'E': return exa;
+				case 'P': return peta;
+				case 'T': return tera;
+				case 'G': return giga;
+				case 'M': return mega;
+				case 'k': return kilo;
+				case 'h': return hecto;
+				case 'c': return centi;
+				case 'm': return milli;
+				case 'u': return micro;
+				case 'n': return nano;
+				case 'p': return pico;
+				case 'f': return femto;
+				case 'a': return atto;
+				case 'z': return zepto;
+				case 'y': return yocto;
+
+				case 'd':
+					if(length >= 2 && name[1] == 'a')
+					{
+						prefixLength = 2;
+						return deca;
+					}
+
+					return deci;
+			}
+
+			// Micro sign (U+00B5) and Greek small letter mu (U+03BC)
+			if(length >= 2 && ((name[0] == '\xC2' && name[1] == '\xB5') || (name[0] == '\xCE' && name[1] == '\xBC')))
+			{
+				prefixLength = 2;
+				return micro;
+			}
+
+			prefixLength = 0;
+			return 1.0;
+		}
+
+		// Exception: kg is the only SI unit with prefix, so grams are resolved
+		// as a thousandth of a kilogram
+		bool lookup_builtin(const char* name, size_t length, double& multiplier, Unit& out)
+		{
+			if(length == 1 && name[0] == 'g')
+			{
+				multiplier *= g.magnitude();
+				out = g.unit();
+				return true;
+			}
+
+			return lookup_unit(name, length, out);
+		}
+
+		// The registry is only pinned when the built-in table misses, so the
+		// most common symbols never touch it
+		bool resolve_unit(const char* name, size_t length, double& multiplier, Unit& out)
+		{
+			multiplier = 1.0;
+			if(lookup_builtin(name, length, multiplier, out)) return true;
+
+			const RegistryGuard registry;
+			if(registry->find_symbol(name, length, out)) return true;
+
+			size_t prefixLength;
+			multiplier = lookup_prefix(name, length, prefixLength);
+
+			if(prefixLength == 0 || prefixLength == length) return false;
+			return lookup_builtin(name + prefixLength, length - prefixLength, multiplier, out)
+				|| registry->find_symbol(name + prefixLength, length - prefixLength, out);
+		}
+	}
+}
@@ -0,0 +1,77 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "Units/Unit.h"
+
+namespace Units
+{
+	namespace details
+	{
+		constexpr uint32_t hash_step(const char* str, uint32_t h)
+		{
+			return *str == '\0' ? h : hash_step(str + 1, (h ^ (uint32_t)(unsigned char)*str) * 16777619u);
+		}
+
+		/** @brief 32-bit FNV-1a hash of a null-terminated string, usable at compile time */
+		constexpr uint32_t hash(const char* str)
+		{
+			return hash_step(str, 2166136261u);
+		}
+
+		/** @brief 32-bit FNV-1a hash of a range of bytes */
+		inline uint32_t hash(const char* str, size_t length)
+		{
+			uint32_t h = 2166136261u;
+
+			for(size_t i = 0; i < length; i++)
+				h = (h ^ (uint32_t)(unsigned char)str[i]) * 16777619u;
+
+			return h;
+		}
+
+		/**
+		 * @brief Look up an unprefixed unit symbol (UTF-8)
+		 *
+		 * The symbol table is a `switch` over the compile-time hash of every
+		 * symbol, so nothing is built at startup and any hash collision
+		 * between two symbols is a compile error.
+		 *
+		 * @returns @cpp false @ce if the symbol is unknown
+		 */
+		bool lookup_unit(const char* name, size_t length, Unit& out);
+
+		/**
+		 * @brief Look up an unprefixed symbol of the parser (UTF-8)
+		 *
+		 * Like @ref lookup_unit(), but also resolves `g` (with a multiplier
+		 * of 0.001 on top of @p multiplier). These symbols take precedence
+		 * over every name of the registry.
+		 */
+		bool lookup_builtin(const char* name, size_t length, double& multiplier, Unit& out);
+
+		/**
+		 * @brief Look up the SI prefix at the start of a symbol (UTF-8)
+		 *
+		 * @param[out] prefixLength  Length in bytes of the prefix, or zero if
+		 *                           the symbol does not start with a prefix
+		 *
+		 * @returns the multiplier of the prefix, or 1 if there is none
+		 */
+		double lookup_prefix(const char* name, size_t length, size_t& prefixLength);
+
+		/**
+		 * @brief Resolve a (possibly prefixed) unit symbol in a single pass
+		 *
+		 * The whole symbol is looked up first, so that symbols such as `dBm`
+		 * take precedence over a prefix followed by a unit (`d` + `Bm`).
+		 * Otherwise, a leading prefix is split off and the rest is looked up.
+		 *
+		 * @param[out] multiplier  Multiplier of the prefix (1 if none)
+		 *
+		 * @returns @cpp false @ce if the symbol cannot be resolved
+		 */
+		bool resolve_unit(const char* name, size_t length, double& multiplier, Unit& out);
+	}
+}
@@ -0,0 +1,46 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <thread>
+#include <vector>
+
+namespace Units
+{
+	namespace details
+	{
+		// Amount of threads to use for the given amount of tasks. Zero
+		// requested threads means the hardware concurrency
+		inline unsigned worker_count(unsigned requested, size_t tasks)
+		{
+			unsigned threads = (requested != 0 ? requested : std::thread::hardware_concurrency());
+			if(threads == 0) threads = 1;
+
+			return (unsigned)std::min<size_t>(threads, std::max<size_t>(tasks, 1));
+		}
+
+		// Runs task(i) for every i in [0, tasks) using the given amount of
+		// threads. Tasks are handed out dynamically, so callers must store the
+		// result of each task by its index
+		template<typename Task>
+		void run_tasks(size_t tasks, unsigned threads, Task task)
+		{
+			std::atomic<size_t> next(0);
+
+			auto worker = [&]() {
+				for(size_t i = next++; i < tasks; i = next++)
+					task(i);
+			};
+
+			std::vector<std::thread> pool;
+			for(unsigned t = 1; t < threads; t++)
+				pool.emplace_back(worker);
+
+			worker();
+
+			for(std::thread& th : pool)
+				th.join();
+		}
+	}
+}
@@ -0,0 +1,667 @@
+#include <cmath>
+#include <cstring>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "Units/Units.h"
+#include "Units/Ucum.h"
+#include "Units/addons/std.h"
+#include "Symbols.h"
+
+namespace Units
+{
+	namespace details
+	{
+		static Unit unit_of(const Quantity& q) { return Unit(q.magnitude(), q.unit()); }
+
+		// UCUM atoms: code, unit of the catalog and whether it accepts a
+		// prefix. When two codes share a unit, the first one is used to
+		// format it. Units of the catalog that are usually written with a
+		// prefix have their own entry, so they round-trip exactly
+#define UCUM_ATOMS(ATOM) \
+			ATOM(u8"m"         , m                                , true ) \
+			ATOM(u8"s"         , s                                , true ) \
+			ATOM(u8"g"         , unit_of(gram)                    , true ) \
+			ATOM(u8"rad"       , rad                              , true ) \
+			ATOM(u8"K"         , K                                , true ) \
+			ATOM(u8"C"         , C                                , true ) \
+			ATOM(u8"cd"        , Cd                               , true ) \
+			ATOM(u8"mol"       , mol                              , true ) \
+			ATOM(u8"sr"        , sr                               , true ) \
+			ATOM(u8"Hz"        , Hz                               , true ) \
+			ATOM(u8"N"         , N                                , true ) \
+			ATOM(u8"Pa"        , Pa                               , true ) \
+			ATOM(u8"J"         , J                                , true ) \
+			ATOM(u8"W"         , W                                , true ) \
+			ATOM(u8"A"         , A                                , true ) \
+			ATOM(u8"V"         , V                                , true ) \
+			ATOM(u8"F"         , F                                , true ) \
+			ATOM(u8"Ohm"       , ohm                              , true ) \
+			ATOM(u8"S"         , S                                , true ) \
+			ATOM(u8"Wb"        , Wb                               , true ) \
+			ATOM(u8"Cel"       , Temperature::degC                , true ) \
+			ATOM(u8"T"         , T                                , true ) \
+			ATOM(u8"H"         , H                                , true ) \
+			ATOM(u8"lm"        , lm                               , true ) \
+			ATOM(u8"lx"        , lx                               , true ) \
+			ATOM(u8"Bq"        , Bq                               , true ) \
+			ATOM(u8"Gy"        , Gy                               , true ) \
+			ATOM(u8"Sv"        , Sv                               , true ) \
+			ATOM(u8"kat"       , kat                              , true ) \
+			ATOM(u8"10*"       , Unit(10.0, none)                 , false) \
+			ATOM(u8"10^"       , Unit(10.0, none)                 , false) \
+			ATOM(u8"[pi]"      , Unit(Constants::pi, none)        , false) \
+			ATOM(u8"%"         , percent                          , false) \
+			ATOM(u8"[ppth]"    , per_mille                        , false) \
+			ATOM(u8"[ppm]"     , ppm                              , false) \
+			ATOM(u8"[ppb]"     , ppb                              , false) \
+			ATOM(u8"L"         , L                                , true ) \
+			ATOM(u8"l"         , L                                , true ) \
+			ATOM(u8"ar"        , Area::are                        , true ) \
+			ATOM(u8"min"       , min                              , false) \
+			ATOM(u8"h"         , h                                , false) \
+			ATOM(u8"d"         , Time::day                        , false) \
+			ATOM(u8"wk"        , Time::week                       , false) \
+			ATOM(u8"a"         , Time::aj                         , false) \
+			ATOM(u8"a_j"       , Time::aj                         , false) \
+			ATOM(u8"a_t"       , unit_of(Time::at)                , false) \
+			ATOM(u8"a_g"       , unit_of(Time::ag)                , false) \
+			ATOM(u8"mo"        , unit_of(Time::moj)               , false) \
+			ATOM(u8"mo_j"      , unit_of(Time::moj)               , false) \
+			ATOM(u8"mo_s"      , unit_of(Time::mos)               , false) \
+			ATOM(u8"mo_g"      , unit_of(Time::mog)               , false) \
+			ATOM(u8"t"         , unit_of(tonne)                   , true ) \
+			ATOM(u8"bar"       , Pressure::bar                    , true ) \
+			ATOM(u8"u"         , Da                               , true ) \
+			ATOM(u8"eV"        , Energy::eV                       , true ) \
+			ATOM(u8"pc"        , Distance::parsec                 , true ) \
+			ATOM(u8"AU"        , Distance::au                     , false) \
+			ATOM(u8"Ao"        , Distance::angstrom               , false) \
+			ATOM(u8"b"         , Area::barn                       , false) \
+			ATOM(u8"[ly]"      , Distance::ly                     , true ) \
+			ATOM(u8"deg"       , Angle::deg                       , false) \
+			ATOM(u8"gon"       , Angle::gon                       , false) \
+			ATOM(u8"'"         , Angle::arcmin                    , false) \
+			ATOM(u8"''"        , Angle::arcsec                    , false) \
+			ATOM(u8"atm"       , Pressure::atm                    , false) \
+			ATOM(u8"att"       , Pressure::att                    , false) \
+			ATOM(u8"mm[Hg]"    , Pressure::mmHg                   , false) \
+			ATOM(u8"mm[H2O]"   , Pressure::mmH2O                  , false) \
+			ATOM(u8"m[Hg]"     , Unit(1e3, Pressure::mmHg)        , true ) \
+			ATOM(u8"m[H2O]"    , Unit(1e3, Pressure::mmH2O)       , true ) \
+			ATOM(u8"[in_i'Hg]" , Pressure::inHg                   , false) \
+			ATOM(u8"[in_i'H2O]", Pressure::inH2O                  , false) \
+			ATOM(u8"[psi]"     , Pressure::psi                    , false) \
+			ATOM(u8"erg"       , CGS::erg                         , true ) \
+			ATOM(u8"dyn"       , CGS::dyn                         , true ) \
+			ATOM(u8"P"         , CGS::poise                       , true ) \
+			ATOM(u8"St"        , CGS::stokes                      , true ) \
+			ATOM(u8"Gal"       , CGS::gal                         , true ) \
+			ATOM(u8"G"         , CGS::gauss                       , true ) \
+			ATOM(u8"Mx"        , CGS::maxwell                     , true ) \
+			ATOM(u8"Oe"        , CGS::oersted                     , true ) \
+			ATOM(u8"Bi"        , CGS::biot                        , true ) \
+			ATOM(u8"Ci"        , CGS::curie                       , true ) \
+			ATOM(u8"R"         , CGS::roentgen                    , true ) \
+			ATOM(u8"RAD"       , CGS::RAD                         , true ) \
+			ATOM(u8"REM"       , CGS::REM                         , true ) \
+			ATOM(u8"cal"       , cal                              , true ) \
+			ATOM(u8"cal_th"    , Energy::cal_th                   , true ) \
+			ATOM(u8"cal_IT"    , Energy::cal_it                   , true ) \
+			ATOM(u8"cal_m"     , Energy::cal_mean                 , true ) \
+			ATOM(u8"cal_[15]"  , Energy::cal_15                   , true ) \
+			ATOM(u8"cal_[20]"  , Energy::cal_20                   , true ) \
+			ATOM(u8"[Cal]"     , unit_of(Energy::kcal)            , false) \
+			ATOM(u8"[Btu]"     , btu                              , false) \
+			ATOM(u8"[Btu_IT]"  , Energy::btu_it                   , false) \
+			ATOM(u8"[Btu_th]"  , Energy::btu_th                   , false) \
+			ATOM(u8"[Btu_m]"   , Energy::btu_mean                 , false) \
+			ATOM(u8"[Btu_39]"  , Energy::btu_39                   , false) \
+			ATOM(u8"[Btu_59]"  , Energy::btu_59                   , false) \
+			ATOM(u8"[Btu_60]"  , Energy::btu_60                   , false) \
+			ATOM(u8"[HP]"      , hp                               , false) \
+			ATOM(u8"[in_i]"    , in                               , false) \
+			ATOM(u8"[ft_i]"    , ft                               , false) \
+			ATOM(u8"[yd_i]"    , yd                               , false) \
+			ATOM(u8"[mi_i]"    , mile                             , false) \
+			ATOM(u8"[mil_i]"   , i::mil                           , false) \
+			ATOM(u8"[nmi_i]"   , Nautical::mile                   , false) \
+			ATOM(u8"[kn_i]"    , Nautical::knot                   , false) \
+			ATOM(u8"[in_us]"   , US::inch                         , false) \
+			ATOM(u8"[ft_us]"   , US::foot                         , false) \
+			ATOM(u8"[mi_us]"   , US::mile                         , false) \
+			ATOM(u8"[acr_us]"  , US::acre                         , false) \
+			ATOM(u8"[gr]"      , i::grain                         , false) \
+			ATOM(u8"[lb_av]"   , lb                               , false) \
+			ATOM(u8"[oz_av]"   , oz                               , false) \
+			ATOM(u8"[dr_av]"   , av::dram                         , false) \
+			ATOM(u8"[stone_av]", av::stone                        , false) \
+			ATOM(u8"[ston_av]" , av::ton                          , false) \
+			ATOM(u8"[lton_av]" , av::longton                      , false) \
+			ATOM(u8"[lbf_av]"  , lbf                              , false) \
+			ATOM(u8"[gal_us]"  , US::gallon                       , false) \
+			ATOM(u8"[qt_us]"   , US::quart                        , false) \
+			ATOM(u8"[pt_us]"   , US::pint                         , false) \
+			ATOM(u8"[cup_us]"  , US::cup                          , false) \
+			ATOM(u8"[foz_us]"  , US::floz                         , false) \
+			ATOM(u8"[tbs_us]"  , US::tbsp                         , false) \
+			ATOM(u8"[tsp_us]"  , US::tsp                          , false) \
+			ATOM(u8"[bbl_us]"  , US::barrel                       , false) \
+			ATOM(u8"[gal_br]"  , Imperial::gallon                 , false) \
+			ATOM(u8"[degF]"    , Temperature::degF                , false) \
+			ATOM(u8"[degR]"    , Temperature::degR                , false) \
+			ATOM(u8"[degRe]"   , Temperature::degRe               , false) \
+			ATOM(u8"bit"       , Data::bit                        , true ) \
+			ATOM(u8"By"        , Data::byte                       , true ) \
+			ATOM(u8"U"         , unit_of(Laboratory::enzyme_unit) , true ) \
+			ATOM(u8"[pH]"      , Laboratory::pH                   , false) \
+			ATOM(u8"[drp]"     , Clinical::drop                   , false) \
+			ATOM(u8"[diop]"    , Clinical::diopter                , false) \
+			ATOM(u8"[mesh_i]"  , Clinical::mesh                   , false) \
+			ATOM(u8"[Ch]"      , Clinical::charriere              , false) \
+			ATOM(u8"[PRU]"     , Clinical::pru                    , false) \
+			ATOM(u8"[wood'U]"  , Clinical::woodu                  , false)
+
+		static bool match_atom(const char* name, size_t length, const char* code, const Unit& un, bool metric, Unit& out, bool& isMetric)
+		{
+			if(std::strlen(code) != length || std::memcmp(name, code, length) != 0) return false;
+
+			out = un;
+			isMetric = metric;
+			return true;
+		}
+
+#define UCUM_CASE(code, un, metric) case hash(code): return match_atom(name, length, code, un, metric, out, isMetric);
+
+		// Same technique as the native symbol table: a `switch` over the
+		// compile-time hash of every code, so any collision between two
+		// codes is a compile error
+		static bool lookup_atom(const char* name, size_t length, Unit& out, bool& isMetric)
+		{
+			switch(hash(name, length))
+			{
+				UCUM_ATOMS(UCUM_CASE)
+			}
+
+			return false;
+		}
+
+#undef UCUM_CASE
+
+		struct UcumPrefix
+		{
+			const char* code;
+			double multiplier;
+		};
+
+		// In the order used to format units, so the most common prefixes win
+		static const UcumPrefix UCUM_PREFIXES[] =
+		{
+			{ "k", kilo }, { "m", milli }, { "u", micro }, { "n", nano }, { "M", mega }, { "G", giga },
+			{ "c", centi }, { "p", pico }, { "T", tera }, { "h", hecto }, { "d", deci }, { "da", deca },
+			{ "f", femto }, { "a", atto }, { "P", peta }, { "E", exa }, { "z", zepto }, { "Z", zetta },
+			{ "y", yocto }, { "Y", yotta }, { "Ki", kibi }, { "Mi", mebi }, { "Gi", gibi }, { "Ti", tebi },
+		};
+
+		// Resolve an atom, or a prefix followed by a metric atom
+		static bool resolve_atom(const char* name, size_t length, Unit& out)
+		{
+			bool metric;
+			if(lookup_atom(name, length, out, metric)) return true;
+
+			for(const UcumPrefix& prefix : UCUM_PREFIXES)
+			{
+				const size_t prefixLength = (prefix.code[1] == '\0' ? 1 : 2);
+				if(length <= prefixLength || std::memcmp(name, prefix.code, prefixLength) != 0) continue;
+
+				Unit atom;
+				if(lookup_atom(name + prefixLength, length - prefixLength, atom, metric) && metric)
+				{
+					out = Unit(prefix.multiplier, atom);
+					return true;
+				}
+			}
+
+			return false;
+		}
+
+		static bool is_digit(char ch) { return ch >= '0' && ch <= '9'; }
+
+		// Characters of an atom outside of brackets. Digits, signs and the
+		// operators of the grammar end the atom
+		static bool is_atom(char ch)
+		{
+			return ch > ' ' && ch < 127 && !is_digit(ch) && std::strchr("./(){}+-=,;\"", ch) == nullptr;
+		}
+
+		// Read an integer, saturating so that huge exponents fail instead
+		// of wrapping around
+		static const char* read_integer(const char* first, const char* last, long& out)
+		{
+			out = 0;
+			for(; first != last && is_digit(*first); ++first)
+				if(out < 1000000) out = 10 * out + (*first - '0');
+
+			return first;
+		}
+
+		// Parse a component that is not between parentheses: an annotation,
+		// an integer factor or an atom with an optional exponent and
+		// annotation. On failure, `end` points to the offending character
+		static bool parse_component(const char* first, const char* last, Unit& out, const char*& end)
+		{
+			const char* it = first;
+
+			if(*it == '{')
+			{
+				const char* close = static_cast<const char*>(std::memchr(it, '}', (size_t)(last - it)));
+				end = (close == nullptr ? it : close + 1);
+				out = one;
+				return close != nullptr;
+			}
+
+			if(is_digit(*it) && !(last - it >= 3 && it[0] == '1' && it[1] == '0' && (it[2] == '*' || it[2] == '^')))
+			{
+				long factor;
+				end = read_integer(it, last, factor);
+				out = Unit((double)factor, one);
+				return true;
+			}
+
+			// The atom, with whole bracketed parts (`m[H2O]`, `[in_i'Hg]`)
+			const char* atomEnd = (*it == '1' ? it + 3 : it);
+			while(atomEnd != last)
+			{
+				if(*atomEnd == '[')
+				{
+					const char* close = static_cast<const char*>(std::memchr(atomEnd, ']', (size_t)(last - atomEnd)));
+					if(close == nullptr) { end = atomEnd; return false; }
+
+					atomEnd = close + 1;
+				}
+				else if(is_atom(*atomEnd))
+				{
+					++atomEnd;
+				}
+				else
+				{
+					break;
+				}
+			}
+
+			end = first;
+			if(atomEnd == first || !resolve_atom(first, (size_t)(atomEnd - first), out)) return false;
+
+			it = atomEnd;
+
+			if(it != last && (*it == '+' || *it == '-' || is_digit(*it)))
+			{
+				const bool negative = (*it == '-');
+				if(!is_digit(*it)) ++it;
+
+				long exponent;
+				const char* digits = it;
+				it = read_integer(it, last, exponent);
+
+				if(it == digits || exponent > 127) { end = (it == digits ? it : digits); return false; }
+				out = out ^ (int)(negative ? -exponent : exponent);
+			}
+
+			if(it != last && *it == '{')
+			{
+				const char* close = static_cast<const char*>(std::memchr(it, '}', (size_t)(last - it)));
+				if(close == nullptr) { end = it; return false; }
+
+				it = close + 1;
+			}
+
+			end = it;
+			return true;
+		}
+
+		// Term being evaluated, waiting for a closing parenthesis
+		struct UcumFrame
+		{
+			Unit value;
+			bool divide;
+		};
+	}
+
+	ParseResult parse_ucum(const char* first, const char* last, Unit& out, const ParseLimits& limits)
+	{
+		using namespace details;
+
+		while(first != last && (*first == ' ' || *first == '\t' || *first == '\n' || *first == '\v' || *first == '\f' || *first == '\r')) ++first;
+		if((size_t)(last - first) > limits.max_length) return { first + limits.max_length, std::errc::value_too_large };
+
+		std::vector<UcumFrame> stack;
+		Unit value = one;
+		bool divide = false;
+		const char* it = first;
+
+		// A term may start with a solidus (`/min`)
+		if(it != last && *it == '/')
+		{
+			divide = true;
+			++it;
+		}
+
+		for(;;)
+		{
+			if(it == last) return { it, std::errc::invalid_argument };
+
+			if(*it == '(')
+			{
+				if(stack.size() >= limits.max_depth) return { it, std::errc::value_too_large };
+
+				stack.push_back(UcumFrame{ value, divide });
+				value = one;
+				divide = false;
+
+				if(++it != last && *it == '/')
+				{
+					divide = true;
+					++it;
+				}
+
+				continue;
+			}
+
+			Unit component;
+			const char* end;
+			if(!parse_component(it, last, component, end)) return { end, std::errc::invalid_argument };
+
+			value = (divide ? value / component : value * component);
+			it = end;
+
+			// Closing parentheses complete the terms of the enclosing frames
+			while(it != last && *it == ')' && !stack.empty())
+			{
+				const UcumFrame frame = stack.back();
+				stack.pop_back();
+
+				value = (frame.divide ? frame.value / value : frame.value * value);
+				++it;
+			}
+
+			if(it != last && (*it == '.' || *it == '/'))
+			{
+				divide = (*it == '/');
+				++it;
+				continue;
+			}
+
+			if(!stack.empty()) return { it, std::errc::invalid_argument };
+
+			out = value;
+			return { it, std::errc() };
+		}
+	}
+
+	Unit ucum_to_unit(const std::string& code)
+	{
+		Unit ret;
+		const ParseResult result = parse_ucum(code.data(), code.data() + code.size(), ret);
+
+		if(result.ec != std::errc() || result.ptr != code.data() + code.size()) return Unit::error();
+		return ret;
+	}
+
+	namespace details
+	{
+		struct UcumAtom
+		{
+			const char* code;
+			Unit unit;
+			bool metric;
+		};
+
+		// Unit::multiplier() rounds to six decimals, which would erase the
+		// multipliers of small units (µL, ng), so the unit is scaled first
+		static double full_multiplier(const Unit& un)
+		{
+			Unit scaled = un;
+			double scale = 1.0;
+
+			while(scaled.multiplier() < 1e3f && scale < 1e30)
+			{
+				scaled = Unit(1e6, scaled);
+				scale *= 1e6;
+			}
+
+			return (double)scaled.multiplier() / scale;
+		}
+
+		static bool same_multiplier(double a, double b)
+		{
+			return std::fabs(a - b) <= 5e-7 * std::fabs(b);
+		}
+
+		struct UcumCode
+		{
+			double multiplier;
+			unsigned rank;
+			std::string code;
+			bool raised;
+		};
+
+		// Codes of every atom and of every prefixed metric atom, grouped by
+		// dimensions. Within a group, atoms come first and then prefixed
+		// atoms in the order of UCUM_PREFIXES, which is also their rank.
+		// Squares, cubes and inverses of those follow with the same rank, so
+		// that `m3` is preferred to `kL` and `/s2` is found at all
+		typedef std::unordered_map<UnitData::BaseUnitType, std::vector<UcumCode>> UcumCodes;
+
+		static void add_powers(UcumCodes& codes, const Unit& un, unsigned rank, const std::string& code)
+		{
+			static const int powers[] = { 2, 3, -1, -2, -3 };
+
+			// Dimensionless atoms (`%`, `10*`) are not raised
+			if(un.unit_count() == 0) return;
+
+			for(int power : powers)
+			{
+				const Unit raised = un ^ power;
+
+				// Exponents that do not fit in UnitData would wrap around
+				bool fits = true;
+				for(int base = UnitData::METER; base <= UnitData::COUNT; base++)
+					fits = fits && raised.exponent((UnitData::BaseUnit)base) == un.exponent((UnitData::BaseUnit)base) * power;
+
+				const double multiplier = std::pow(full_multiplier(un), power);
+				if(!fits || !std::isfinite(multiplier)) continue;
+
+				const std::string exponent = (power == -1 ? std::string() : std::to_string(power < 0 ? -power : power));
+				codes[raised.base_units()].push_back(UcumCode{ multiplier, rank, (power < 0 ? "/" + code : code) + exponent, true });
+			}
+		}
+
+		static UcumCodes build_ucum_codes()
+		{
+#define UCUM_ENTRY(code, un, metric) { code, un, metric },
+			const UcumAtom atoms[] = { UCUM_ATOMS(UCUM_ENTRY) };
+#undef UCUM_ENTRY
+
+			UcumCodes codes;
+			codes[one.base_units()].push_back(UcumCode{ 1.0, 0, "1", false });
+
+			for(const UcumAtom& atom : atoms)
+				codes[atom.unit.base_units()].push_back(UcumCode{ full_multiplier(atom.unit), 0, atom.code, false });
+
+			unsigned rank = 1;
+			for(const UcumPrefix& prefix : UCUM_PREFIXES)
+			{
+				for(const UcumAtom& atom : atoms)
+				{
+					if(!atom.metric) continue;
+
+					const Unit un = Unit(prefix.multiplier, atom.unit);
+					codes[un.base_units()].push_back(UcumCode{ full_multiplier(un), rank, std::string(prefix.code) + atom.code, false });
+				}
+
+				rank++;
+			}
+
+			for(const UcumAtom& atom : atoms)
+				add_powers(codes, atom.unit, 0, atom.code);
+
+			rank = 1;
+			for(const UcumPrefix& prefix : UCUM_PREFIXES)
+			{
+				for(const UcumAtom& atom : atoms)
+					if(atom.metric) add_powers(codes, Unit(prefix.multiplier, atom.unit), rank, std::string(prefix.code) + atom.code);
+
+				rank++;
+			}
+
+			return codes;
+		}
+
+		// Multipliers are compared with a relative tolerance, since units
+		// built by arithmetic (`km/h * h`) carry float rounding errors. The
+		// tolerance still tells apart close units such as the international
+		// and imperial inches
+		static const UcumCode* find_code(const Unit& un)
+		{
+			static const UcumCodes codes = build_ucum_codes();
+
+			auto it = codes.find(un.base_units());
+			if(it == codes.end()) return nullptr;
+
+			const double multiplier = full_multiplier(un);
+			const UcumCode* best = nullptr;
+
+			for(const UcumCode& code : it->second)
+				if(same_multiplier(code.multiplier, multiplier) && (best == nullptr || code.rank < best->rank)) best = &code;
+
+			return best;
+		}
+
+		// Write a unit in base units, with a power of ten or an integer as
+		// factor. Fails for units that have no UCUM base unit (currency,
+		// counts, flags) or a factor that is not an integer. The cost grows
+		// with every term after the first, every negative exponent and the
+		// factor, so that `kg.m` and `10*3` are kept but `g/L` is preferred
+		// to `kg.m-3`
+		static bool format_base_units(const Unit& un, std::string& ret, unsigned& cost)
+		{
+			static const struct { const char* code; UnitData::BaseUnit base; } bases[] =
+			{
+				{ "kg", UnitData::KILOGRAM }, { "m", UnitData::METER }, { "s", UnitData::SECOND }, { "A", UnitData::AMPERE },
+				{ "K", UnitData::KELVIN }, { "mol", UnitData::MOLE }, { "rad", UnitData::RADIAN }, { "cd", UnitData::CANDELA },
+			};
+
+			// Only units made of the bases above, without flags, can be
+			// written: rebuilding them from those exponents must give them back
+			const UnitData ucum = UnitData::from_exponents(
+				(int8_t)un.exponent(UnitData::METER), (int8_t)un.exponent(UnitData::KILOGRAM),
+				(int8_t)un.exponent(UnitData::SECOND), (int8_t)un.exponent(UnitData::AMPERE),
+				(int8_t)un.exponent(UnitData::KELVIN), (int8_t)un.exponent(UnitData::MOLE),
+				(int8_t)un.exponent(UnitData::RADIAN), (int8_t)un.exponent(UnitData::CANDELA),
+				0, 0, false, false, false);
+
+			if(ucum.base_unit() != un.base_units()) return false;
+
+			std::string codes;
+			unsigned terms = 0;
+			cost = 0;
+
+			for(const auto& b : bases)
+			{
+				const int exponent = un.exponent(b.base);
+				if(exponent == 0) continue;
+
+				if(!codes.empty()) codes += '.';
+				codes += b.code;
+				if(exponent != 1) codes += std::to_string(exponent);
+
+				terms++;
+				if(exponent < 0) cost++;
+			}
+
+			const double multiplier = full_multiplier(un);
+			const int power = (multiplier > 0.0 ? (int)std::lround(std::log10(multiplier)) : 0);
+			const double integer = std::round(multiplier);
+
+			std::string factor;
+			if(same_multiplier(multiplier, 1.0)) factor = "";
+			else if(same_multiplier(multiplier, std::pow(10.0, power))) factor = "10*" + std::to_string(power);
+			else if(integer >= 1.0 && integer < 1e9 && same_multiplier(multiplier, integer)) factor = std::to_string((long)integer);
+			else return false;
+
+			if(codes.empty()) ret = (factor.empty() ? "1" : factor);
+			else ret = (factor.empty() ? codes : factor + "." + codes);
+
+			if(!factor.empty()) cost += terms + 1;
+			else if(terms > 1) cost += terms - 1;
+
+			return true;
+		}
+	}
+
+	std::string to_ucum(const Unit& un)
+	{
+		using namespace details;
+		if(un == Unit::error()) return std::string();
+
+		std::string ret;
+		unsigned cost = 0;
+
+		// An atom, possibly prefixed or raised to a power, costs as much as
+		// the rank of its prefix (`m3` rather than `kL`)
+		const UcumCode* best = find_code(un);
+		if(best != nullptr)
+		{
+			ret = best->code;
+			cost = best->rank;
+		}
+
+		// Base units are kept unless they need more terms (`kg.m` rather
+		// than `N.s2`, `10*3` rather than `t/kg`)
+		std::string base;
+		unsigned baseCost;
+
+		if(format_base_units(un, base, baseCost) && (ret.empty() || baseCost < cost))
+		{
+			ret = base;
+			cost = baseCost;
+		}
+
+		// An atom divided or multiplied by a common unit (`km/h`, `mg/dL`,
+		// `kW.h`). The least unusual prefix wins (`mg/dL` rather than
+		// `dag/m3`), and the extra unit costs as much as one step of prefix
+		// (`kPa` rather than `J/L`, but `m/s2` rather than `hGal`). The atom
+		// may not have more dimensions than the unit, which would only
+		// cancel them again (`Gy.s2` for `m2`), nor be raised to a power
+		static const std::pair<const char*, Unit> others[] =
+		{
+			{ "s", s }, { "s2", s^2 }, { "min", min }, { "h", h }, { "d", Time::day }, { "m", m }, { "m2", m^2 }, { "m3", m^3 },
+			{ "L", L }, { "dL", Unit(deci, L) }, { "uL", Unit(micro, L) }, { "g", unit_of(gram) }, { "kg", kg }, { "mol", mol },
+		};
+
+		for(const auto& other : others)
+		{
+			for(int product = 0; product < 2; product++)
+			{
+				if(!ret.empty() && cost == 0) break;
+
+				const Unit atom = (product ? un / other.second : un * other.second);
+				if(atom.unit_count() > un.unit_count()) continue;
+
+				const UcumCode* code = find_code(atom);
+				if(code != nullptr && !code->raised && !(product && code->code == "1") && (ret.empty() || code->rank + 1 < cost))
+				{
+					// A dimensionless numerator is left out (`/min`)
+					const std::string suffix = (product ? "." : "/") + std::string(other.first);
+					ret = (code->code == "1" ? suffix : code->code + suffix);
+					cost = code->rank + 1;
+				}
+			}
+		}
+
+		return ret;
+	}
+}
+
+#undef UCUM_ATOMS
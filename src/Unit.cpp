@@ -16,6 +16,11 @@ namespace Units
 		return m_Data.base_unit();
 	}
 
+	int Unit::exponent(UnitData::BaseUnit base) const
+	{
+		return m_Data.exponent(base);
+	}
+
 	float Unit::multiplier() const
 	{
 		return cround(m_Multiplier);
@@ -31,11 +36,6 @@ namespace Units
 		return m_Data.unit_count();
 	}
 
-	Unit Unit::operator^(const int exp) const
-	{
-		return Unit(std::pow(m_Multiplier, static_cast<float>(exp)), m_Data^exp);
-	}
-
 	Unit Unit::operator+(const Unit& rhs) const
 	{
 		return (*this == rhs ? *this : Unit::error());
@@ -46,16 +46,6 @@ namespace Units
 		return (*this == rhs ? *this : Unit::error());
 	}
 
-	Unit Unit::operator*(const Unit& rhs) const
-	{
-		return Unit(m_Multiplier * rhs.m_Multiplier, m_Data * rhs.m_Data);
-	}
-
-	Unit Unit::operator/(const Unit& rhs) const
-	{
-		return Unit(m_Multiplier / rhs.m_Multiplier, m_Data / rhs.m_Data);
-	}
-
 	Unit& Unit::operator^=(const int   exp) { return *this = *this ^ exp; }
 	Unit& Unit::operator+=(const Unit& rhs) { return *this = *this + rhs; }
 	Unit& Unit::operator-=(const Unit& rhs) { return *this = *this - rhs; }
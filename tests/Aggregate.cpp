@@ -0,0 +1,63 @@
+#include <vector>
+
+#include "Units/Units.h"
+#include "Units/Aggregate.h"
+
+#include "catch2/catch.hpp"
+
+using namespace Units;
+
+TEST_CASE("Aggregations over quantities", "[aggregate]")
+{
+	const QuantityArray values(std::vector<double>{ 2.0, 4.0, 4.0, 4.0, 5.0, 5.0, 7.0, 9.0 }, m);
+
+	SECTION("Basic statistics of a column")
+	{
+		CHECK(Stats::sum(values) == 40.0 * m);
+		CHECK(Stats::mean(values) == 5.0 * m);
+		CHECK(Stats::min(values) == 2.0 * m);
+		CHECK(Stats::max(values) == 9.0 * m);
+		CHECK(Stats::variance(values) == 4.0 * (m^2));
+		CHECK(Stats::variance(values).unit() == (m^2));
+		CHECK(Stats::stddev(values) == 2.0 * m);
+		CHECK(Stats::variance(values, true).magnitude() == Approx(32.0 / 7.0));
+	}
+
+	SECTION("Ranges are normalized to the unit of the first element")
+	{
+		const std::vector<Quantity> mixed = { 1.0 * s, 1.0 * min, Quantity(500.0, Unit(milli, s)) };
+
+		CHECK(Stats::sum(mixed).unit() == s);
+		CHECK(Stats::sum(mixed).magnitude() == Approx(61.5));
+		CHECK(Stats::max(mixed).magnitude() == Approx(60.0));
+		CHECK(Stats::min(mixed).magnitude() == Approx(0.5));
+		CHECK(Stats::mean(mixed).magnitude() == Approx(20.5));
+	}
+
+	SECTION("Incompatible ranges return an error")
+	{
+		const std::vector<Quantity> mixed = { 1.0 * s, 1.0 * m };
+
+		CHECK(Stats::sum(mixed).unit() == error);
+		CHECK(Stats::variance(mixed).unit() == error);
+		CHECK(Stats::stddev(mixed).unit() == error);
+	}
+
+	SECTION("Summation is compensated")
+	{
+		std::vector<double> data;
+		data.push_back(1.0);
+		for(int i = 0; i < 10000; i++) data.push_back(1e-16);
+
+		CHECK(Stats::sum(QuantityArray(data, J)).magnitude() == Approx(1.0 + 1e-12).epsilon(1e-15));
+		CHECK(Stats::sum(QuantityArray(std::vector<double>{ 1.0, 1e100, 1.0, -1e100 }, J)).magnitude() == Approx(2.0));
+	}
+
+	SECTION("Empty ranges")
+	{
+		CHECK(Stats::sum(QuantityArray(m)) == 0.0 * m);
+		CHECK(std::isnan(Stats::mean(QuantityArray(m)).magnitude()));
+		CHECK(std::isnan(Stats::min(std::vector<Quantity>()).magnitude()));
+		CHECK(std::isnan(Stats::stddev(std::vector<Quantity>()).magnitude()));
+	}
+}
@@ -0,0 +1,108 @@
+#include <vector>
+
+#include "Units/Units.h"
+#include "Units/Arithmetic.h"
+
+#include "catch2/catch.hpp"
+
+using namespace Units;
+
+TEST_CASE("Element-wise arithmetic between quantity arrays", "[arithmetic]")
+{
+	const QuantityArray voltage(std::vector<double>{ 1.0, 2.0, 3.0 }, V);
+	const QuantityArray current(std::vector<double>{ 0.5, 0.25, 2.0 }, A);
+
+	SECTION("Multiplication and division compute the unit once")
+	{
+		const QuantityArray power = voltage * current;
+
+		REQUIRE(power.size() == 3);
+		CHECK(power.unit() == W);
+		CHECK(power[0].magnitude() == Approx(0.5));
+		CHECK(power[2].magnitude() == Approx(6.0));
+
+		const QuantityArray resistance = voltage / current;
+		CHECK(resistance.unit() == ohm);
+		CHECK(resistance[1].magnitude() == Approx(8.0));
+	}
+
+	SECTION("Addition converts the right-hand side")
+	{
+		const QuantityArray a(std::vector<double>{ 1.0, 2.0 }, m);
+		const QuantityArray b(std::vector<double>{ 1.0, 0.5 }, Unit(1000.0, m));
+
+		const QuantityArray sum = a + b;
+		REQUIRE(sum.size() == 2);
+		CHECK(sum.unit() == m);
+		CHECK(sum[0].magnitude() == Approx(1001.0));
+		CHECK(sum[1].magnitude() == Approx(502.0));
+
+		const QuantityArray diff = b - a;
+		CHECK(diff.unit() == Unit(1000.0, m));
+		CHECK(diff[0].magnitude() == Approx(0.999));
+	}
+
+	SECTION("Incompatible units and sizes are rejected")
+	{
+		CHECK((voltage + current).unit() == Unit::error());
+		CHECK((voltage + current).empty());
+		CHECK((voltage - current).unit() == Unit::error());
+
+		const QuantityArray shorter(std::vector<double>{ 1.0 }, A);
+		CHECK((voltage * shorter).unit() == Unit::error());
+		CHECK((voltage / shorter).empty());
+	}
+
+	SECTION("Multiply-add")
+	{
+		const QuantityArray offset(std::vector<double>{ 1.0, 1.0, 1.0 }, W);
+		const QuantityArray ret = fma(voltage, current, offset);
+
+		REQUIRE(ret.size() == 3);
+		CHECK(ret.unit() == W);
+		CHECK(ret[0].magnitude() == Approx(1.5));
+		CHECK(ret[2].magnitude() == Approx(7.0));
+
+		CHECK(fma(voltage, current, voltage).unit() == Unit::error());
+	}
+}
+
+TEST_CASE("Element-wise arithmetic between ranges of quantities", "[arithmetic]")
+{
+	const std::vector<Quantity> distance = { 10.0 * m, 20.0 * m, 30.0 * m };
+	const std::vector<Quantity> time = { 2.0 * s, 4.0 * s, 5.0 * s };
+
+	SECTION("Ranges sharing a unit")
+	{
+		std::vector<Quantity> speed(3);
+
+		REQUIRE(divide(distance.data(), distance.data() + 3, time.data(), speed.data()));
+		CHECK(speed[0].unit() == m / s);
+		CHECK(speed[2].magnitude() == Approx(6.0));
+
+		REQUIRE(multiply(speed.data(), speed.data() + 3, time.data(), speed.data()));
+		CHECK(speed[1].unit() == m);
+		CHECK(speed[1].magnitude() == Approx(20.0));
+
+		std::vector<Quantity> ret(3);
+		REQUIRE(add(distance.data(), distance.data() + 3, distance.data(), ret.data()));
+		CHECK(ret[2].magnitude() == Approx(60.0));
+
+		REQUIRE(subtract(distance.data(), distance.data() + 3, distance.data(), ret.data()));
+		CHECK(ret[2].magnitude() == Approx(0.0));
+
+		REQUIRE(fma(distance.data(), distance.data() + 3, distance.data(), std::vector<Quantity>(3, 1.0 * (m^2)).data(), ret.data()));
+		CHECK(ret[0].unit() == (m^2));
+		CHECK(ret[0].magnitude() == Approx(101.0));
+	}
+
+	SECTION("Mixed units within a range and incompatible units are rejected")
+	{
+		const std::vector<Quantity> mixed = { 1.0 * m, 1.0 * s, 1.0 * m };
+		std::vector<Quantity> ret(3, 7.0 * m);
+
+		CHECK_FALSE(multiply(mixed.data(), mixed.data() + 3, distance.data(), ret.data()));
+		CHECK_FALSE(add(distance.data(), distance.data() + 3, time.data(), ret.data()));
+		CHECK(ret[0].magnitude() == Approx(7.0));
+	}
+}
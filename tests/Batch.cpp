@@ -0,0 +1,141 @@
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "Units/Units.h"
+#include "Units/IO.h"
+#include "Units/Batch.h"
+#include "Units/Registry.h"
+
+#include "catch2/catch.hpp"
+
+using namespace Units;
+
+TEST_CASE("Parsing batches of quantities", "[quantity][input][batch]")
+{
+	SECTION("Results match to_quantity()")
+	{
+		const std::vector<std::string> inputs = { "1 km/h", " 9.81 m/s^2 ", "-3.5e-3 mV", "42", "300 K", "1.5 kWh", "2 km/h" };
+
+		std::vector<Quantity> out;
+		std::vector<uint8_t> status;
+		CHECK(parse_batch(inputs, out, status) == inputs.size());
+
+		REQUIRE(out.size() == inputs.size());
+		REQUIRE(status.size() == inputs.size());
+
+		for(size_t i = 0; i < inputs.size(); i++)
+		{
+			const Quantity expected = to_quantity(inputs[i]);
+
+			CHECK(status[i] == PARSE_OK);
+			CHECK(out[i].unit() == expected.unit());
+			CHECK(out[i].magnitude() == Approx(expected.magnitude()));
+		}
+	}
+
+	SECTION("Failures are reported per string")
+	{
+		const std::vector<std::string> inputs = { "12 m", "m", "", "3 foo", "1e999 m", "4 s", "5 m m)" };
+
+		std::vector<Quantity> out;
+		std::vector<uint8_t> status;
+		CHECK(parse_batch(inputs, out, status) == 2);
+
+		CHECK(status[0] == PARSE_OK);
+		CHECK(status[1] == PARSE_INVALID);
+		CHECK(status[2] == PARSE_INVALID);
+		CHECK(status[3] == PARSE_INVALID);
+		CHECK(status[4] == PARSE_OUT_OF_RANGE);
+		CHECK(status[5] == PARSE_OK);
+		CHECK(status[6] == PARSE_INVALID);
+
+		CHECK(out[0] == 12.0 * m);
+		CHECK(out[1].unit() == Unit::error());
+		CHECK(out[3].unit() == Unit::error());
+		CHECK(out[4].unit() == Unit::error());
+		CHECK(out[5] == 4.0 * s);
+	}
+
+	SECTION("Limits are applied to every string")
+	{
+		const std::vector<std::string> inputs = { "1 m", "1 ((((m))))", "123456789 m" };
+
+		std::vector<Quantity> out;
+		std::vector<uint8_t> status;
+		CHECK(parse_batch(inputs, out, status, BatchOptions(1, 4096, ParseLimits(2, 10))) == 1);
+
+		CHECK(status[0] == PARSE_OK);
+		CHECK(status[1] == PARSE_TOO_LARGE);
+		CHECK(status[2] == PARSE_TOO_LARGE);
+	}
+
+	SECTION("Views and a missing status array")
+	{
+		const std::string text = "5 m;7 s;x";
+		const TextView views[] = { { text.data(), 3 }, { text.data() + 4, 3 }, { text.data() + 8, 1 } };
+
+		Quantity out[3];
+		CHECK(parse_batch(views, 3, out, nullptr) == 2);
+		CHECK(out[0] == 5.0 * m);
+		CHECK(out[1] == 7.0 * s);
+		CHECK(out[2].unit() == Unit::error());
+	}
+
+	SECTION("Parallel parsing gives the same results")
+	{
+		const char* units[] = { "m", "km/h", "kPa", "L/min", "bad", "m^2" };
+
+		std::vector<std::string> inputs;
+		for(int i = 0; i < 5000; i++)
+			inputs.push_back(std::to_string(i) + " " + units[i % 6]);
+
+		std::vector<Quantity> serial, parallel;
+		std::vector<uint8_t> serialStatus, parallelStatus;
+
+		const size_t parsed = parse_batch(inputs, serial, serialStatus);
+		CHECK(parsed == 5000 - 5000 / 6);
+		CHECK(parse_batch(inputs, parallel, parallelStatus, BatchOptions(4, 64)) == parsed);
+
+		CHECK(serialStatus == parallelStatus);
+
+		bool same = true;
+		for(size_t i = 0; i < inputs.size(); i++)
+			if(serialStatus[i] == PARSE_OK && !(serial[i] == parallel[i])) same = false;
+
+		CHECK(same);
+	}
+
+	SECTION("Registered units are seen by every worker")
+	{
+		REQUIRE(register_unit("batchrev", Unit(2.0 * Constants::pi, rad)));
+
+		std::vector<std::string> inputs;
+		for(int i = 0; i < 2000; i++)
+			inputs.push_back(std::to_string(i) + (i % 2 == 0 ? " batchrev/s" : " kbatchrev"));
+
+		// Registering more units meanwhile publishes newer snapshots, which
+		// must not free the one pinned by the batch
+		std::thread writer([] {
+			for(int i = 0; i < 50; i++)
+				register_unit("batchtmp" + std::to_string(i), Unit(i + 1.0, m));
+		});
+
+		std::vector<Quantity> out;
+		std::vector<uint8_t> status;
+		const size_t parsed = parse_batch(inputs, out, status, BatchOptions(4, 16));
+		writer.join();
+
+		CHECK(parsed == inputs.size());
+		CHECK(out[2] == to_quantity("2 batchrev/s"));
+		CHECK(out[3] == to_quantity("3 kbatchrev"));
+	}
+
+	SECTION("Empty batches")
+	{
+		std::vector<Quantity> out;
+		std::vector<uint8_t> status;
+		CHECK(parse_batch(std::vector<std::string>(), out, status, BatchOptions(0)) == 0);
+		CHECK(out.empty());
+	}
+}
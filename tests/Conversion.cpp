@@ -0,0 +1,62 @@
+#include <cmath>
+
+#include "Units/Units.h"
+#include "Units/Conversion.h"
+
+#include "catch2/catch.hpp"
+
+using namespace Units;
+
+TEST_CASE("Precomputed conversions", "[conversion]")
+{
+	const Unit mK = Unit(1e-3, K);
+	const Unit uK = Unit(1e-6, K);
+
+	SECTION("Linear conversions")
+	{
+		const Conversion conv(Unit(1000.0, m), m);
+
+		CHECK(conv.valid());
+		CHECK_FALSE(conv.identity());
+		CHECK(conv(2.5) == Approx(2500.0));
+		CHECK(conv.offset() == Approx(0.0));
+		CHECK(Conversion(m, m).identity());
+	}
+
+	SECTION("Scales of kelvin have no offset")
+	{
+		const Conversion toKelvin(mK, K);
+		REQUIRE(toKelvin.valid());
+		CHECK(toKelvin.scale() == Approx(1e-3));
+		CHECK(toKelvin.offset() == Approx(0.0));
+		CHECK(toKelvin(5.0) == Approx(0.005));
+
+		CHECK(Conversion(K, mK)(0.3) == Approx(300.0));
+		CHECK(Conversion(uK, K)(250.0) == Approx(2.5e-4));
+		CHECK(Conversion(K, uK)(2.0) == Approx(2e6));
+		CHECK(Conversion(uK, mK)(1500.0) == Approx(1.5));
+	}
+
+	SECTION("Temperature scales with an offset")
+	{
+		CHECK(Conversion(Temperature::degF, K)(32.0) == Approx(273.15));
+		CHECK(Conversion(Temperature::degF, K)(212.0) == Approx(373.15));
+		CHECK(Conversion(K, Temperature::degF)(273.15) == Approx(32.0));
+		CHECK(Conversion(K, Temperature::degF)(0.0) == Approx(-459.67));
+		CHECK(Conversion(mK, Temperature::degF)(273150.0) == Approx(32.0));
+		CHECK(Conversion(Temperature::degRe, K)(80.0) == Approx(373.15));
+
+		// Round trips through kelvin give the original value back
+		const Conversion there(Temperature::degF, K), back(K, Temperature::degF);
+		CHECK(back(there(70.0)) == Approx(70.0));
+	}
+
+	SECTION("Incompatible units")
+	{
+		const Conversion conv(m, s);
+
+		CHECK_FALSE(conv.valid());
+		CHECK(std::isnan(conv(1.0)));
+		CHECK_FALSE(Conversion(Unit::error(), Unit::error()).valid());
+	}
+}
@@ -0,0 +1,198 @@
+#include <cmath>
+#include <string>
+
+#include "Units/Units.h"
+#include "Units/CsvReader.h"
+#include "Units/Conversion.h"
+#include "Units/IO.h"
+
+#include "catch2/catch.hpp"
+
+using namespace Units;
+
+static CsvReader read(const std::string& text, const CsvOptions& options = CsvOptions())
+{
+	CsvReader reader(options);
+	reader.feed(text);
+	reader.finish();
+	return reader;
+}
+
+TEST_CASE("CSV with units in the header", "[csv]")
+{
+	SECTION("Header units are parsed once for the whole column")
+	{
+		const CsvReader reader = read("temperature [K], flow [L/min],energy (kWh),count\n300,1.5,2,7\r\n301.5,2,0.5,8\n");
+
+		REQUIRE(reader.has_header());
+		REQUIRE(reader.columns().size() == 4);
+		CHECK(reader.rows() == 2);
+		CHECK(reader.errors().empty());
+
+		CHECK(reader.columns()[0].name == "temperature");
+		CHECK(reader.columns()[0].values.unit() == K);
+		CHECK(reader.columns()[0].values.magnitudes() == std::vector<double>{ 300.0, 301.5 });
+
+		CHECK(reader.columns()[1].name == "flow");
+		CHECK(reader.columns()[1].values.unit() == L / min);
+		CHECK(reader.columns()[1].values[1].magnitude() == Approx(2.0));
+
+		CHECK(reader.columns()[2].name == "energy");
+		CHECK(reader.columns()[2].values.unit() == to_unit("kWh"));
+		CHECK(reader.columns()[2].values[0] == 2.0 * to_unit("kWh"));
+
+		CHECK(reader.columns()[3].name == "count");
+		CHECK(reader.columns()[3].values.unit() == Unit());
+	}
+
+	SECTION("Degree signs in header units")
+	{
+		const CsvReader reader = read(u8"temperature [°C],outside (°F),heading [°]\n21.5,70,90\n");
+
+		REQUIRE(reader.columns().size() == 3);
+		CHECK(reader.errors().empty());
+
+		// Celsius is stored as kelvin, and Fahrenheit converts with its offset
+		CHECK(reader.columns()[0].name == "temperature");
+		CHECK(reader.columns()[0].values.unit() == K);
+		CHECK(reader.columns()[0].values[0].magnitude() == Approx(294.65));
+
+		CHECK(reader.columns()[1].name == "outside");
+		CHECK(reader.columns()[1].values.unit() == Temperature::degF);
+		CHECK(Conversion(reader.columns()[1].values.unit(), K)(reader.columns()[1].values[0].magnitude()) == Approx(294.261111));
+
+		CHECK(reader.columns()[2].name == "heading");
+		CHECK(reader.columns()[2].values.unit() == Angle::deg);
+	}
+
+	SECTION("Temperature overrides")
+	{
+		const CsvReader reader = read(u8"temp [mK],celsius [°C]\n1,20\n0.3 K,300 K\n2 K,32 \u00B0F\n");
+
+		CHECK(reader.errors().empty());
+		CHECK(reader.columns()[0].values[0].magnitude() == Approx(1.0));
+		CHECK(reader.columns()[0].values[1].magnitude() == Approx(300.0));
+		CHECK(reader.columns()[0].values[2].magnitude() == Approx(2000.0));
+
+		CHECK(reader.columns()[1].values[0].magnitude() == Approx(293.15));
+		CHECK(reader.columns()[1].values[1].magnitude() == Approx(300.0));
+		CHECK(reader.columns()[1].values[2].magnitude() == Approx(273.15));
+	}
+
+	SECTION("Cells that cannot be converted are errors")
+	{
+		const CsvReader reader = read("length [m]\n1\n2 s\n3 km\n");
+
+		REQUIRE(reader.errors().size() == 1);
+		CHECK(reader.errors()[0].row == 1);
+		CHECK(std::isnan(reader.columns()[0].values[1].magnitude()));
+		CHECK(reader.columns()[0].values[2].magnitude() == Approx(3000.0));
+	}
+
+	SECTION("Cells may override the unit of their column")
+	{
+		const CsvReader reader = read("length [mm],time [s]\n12,1\n3 cm,500 ms\n0.5 m, 2 min \n4 kg,1\n");
+
+		REQUIRE(reader.rows() == 4);
+
+		const QuantityArray& length = reader.columns()[0].values;
+		CHECK(length.unit() == to_unit("mm"));
+		CHECK(length[0].magnitude() == Approx(12.0));
+		CHECK(length[1].magnitude() == Approx(30.0));
+		CHECK(length[2].magnitude() == Approx(500.0));
+		CHECK(std::isnan(length[3].magnitude()));
+
+		const QuantityArray& time = reader.columns()[1].values;
+		CHECK(time[1].magnitude() == Approx(0.5));
+		CHECK(time[2].magnitude() == Approx(120.0));
+
+		REQUIRE(reader.errors().size() == 1);
+		CHECK(reader.errors()[0].row == 3);
+		CHECK(reader.errors()[0].column == 0);
+	}
+
+	SECTION("Empty, invalid, missing and extra cells")
+	{
+		const CsvReader reader = read("a [m],b [m]\n1,\nfoo,2\n3\n\n4,5,6\n");
+
+		REQUIRE(reader.rows() == 4);
+
+		const QuantityArray& a = reader.columns()[0].values;
+		const QuantityArray& b = reader.columns()[1].values;
+		CHECK(a[0].magnitude() == Approx(1.0));
+		CHECK(std::isnan(b[0].magnitude()));
+		CHECK(std::isnan(a[1].magnitude()));
+		CHECK(std::isnan(b[2].magnitude()));
+		CHECK(b[3].magnitude() == Approx(5.0));
+
+		REQUIRE(reader.errors().size() == 3);
+		CHECK((reader.errors()[0].row == 1 && reader.errors()[0].column == 0));
+		CHECK((reader.errors()[1].row == 2 && reader.errors()[1].column == 1));
+		CHECK((reader.errors()[2].row == 3 && reader.errors()[2].column == 2));
+	}
+
+	SECTION("Invalid header units")
+	{
+		const CsvReader reader = read("a [foo],b\n1,2\n");
+
+		CHECK(reader.columns()[0].values.unit() == Unit::error());
+		CHECK(std::isnan(reader.columns()[0].values[0].magnitude()));
+		CHECK(reader.columns()[1].values[0].magnitude() == Approx(2.0));
+		REQUIRE(reader.errors().size() == 1);
+		CHECK(reader.errors()[0].column == 0);
+	}
+
+	SECTION("Quoted cells")
+	{
+		const CsvReader reader = read("\"pressure, abs [kPa]\";\"note \"\"x\"\"\"\n\"101.3\";\"7\"\n\"1\n2\";3\n", CsvOptions(';'));
+
+		REQUIRE(reader.columns().size() == 2);
+		CHECK(reader.columns()[0].name == "pressure, abs");
+		CHECK(reader.columns()[0].values.unit() == to_unit("kPa"));
+		CHECK(reader.columns()[1].name == "note \"x\"");
+
+		REQUIRE(reader.rows() == 2);
+		CHECK(reader.columns()[0].values[0].magnitude() == Approx(101.3));
+		CHECK(reader.columns()[1].values[0].magnitude() == Approx(7.0));
+		CHECK(std::isnan(reader.columns()[0].values[1].magnitude()));
+		CHECK(reader.columns()[1].values[1].magnitude() == Approx(3.0));
+	}
+
+	SECTION("Rows are streamed across chunks")
+	{
+		const std::string text = "v [m/s],\"q\"\n1.5,\"2\n\"\n-3e2,4\n5,6";
+
+		for(size_t split = 0; split <= text.size(); split++)
+		{
+			CsvReader reader;
+			const size_t first = reader.feed(text.substr(0, split));
+			const size_t second = reader.feed(text.substr(split));
+
+			CHECK(first + second == 2);
+			CHECK(reader.finish() == 1);
+
+			REQUIRE(reader.rows() == 3);
+			CHECK(reader.columns()[0].values.magnitudes() == std::vector<double>{ 1.5, -300.0, 5.0 });
+			CHECK(reader.columns()[1].values[0].magnitude() == Approx(2.0));
+			CHECK(reader.columns()[1].values[2].magnitude() == Approx(6.0));
+		}
+	}
+
+	SECTION("Clearing keeps the header")
+	{
+		CsvReader reader;
+		reader.feed("x [s]\n1\nbad\n");
+
+		CHECK(reader.rows() == 2);
+		CHECK(reader.errors().size() == 1);
+
+		reader.clear();
+		CHECK(reader.rows() == 0);
+		CHECK(reader.errors().empty());
+		CHECK(reader.columns()[0].values.empty());
+
+		reader.feed("2\n");
+		CHECK(reader.columns()[0].values.unit() == s);
+		CHECK(reader.columns()[0].values.magnitudes() == std::vector<double>{ 2.0 });
+	}
+}
@@ -0,0 +1,63 @@
+#include "Units/Units.h"
+#include "Units/Filter.h"
+
+#include "catch2/catch.hpp"
+
+using namespace Units;
+
+TEST_CASE("Filters over quantity columns", "[filter]")
+{
+	// 5 bar is roughly 72.52 psi
+	const QuantityArray psi(std::vector<double>{ 10.0, 72.0, 73.0, 100.0, 150.0 }, Pressure::psi);
+	const QuantityArray pa(std::vector<double>{ 1e5, 5e5, 6e5, 1e6 }, Pa);
+
+	SECTION("Threshold is converted into the unit of each column")
+	{
+		CHECK(Filter(psi).where(Comparison::Greater, 5.0 * Pressure::bar).select() == std::vector<size_t>{ 2, 3, 4 });
+		CHECK(Filter(pa ).where(Comparison::Greater, 5.0 * Pressure::bar).select() == std::vector<size_t>{ 2, 3 });
+	}
+
+	SECTION("Chained range predicates")
+	{
+		Filter f(psi);
+		f.where(Comparison::GreaterEqual, 5.0 * Pressure::bar).where(Comparison::Less, 120.0 * Pressure::psi);
+
+		CHECK(f.select() == std::vector<size_t>{ 2, 3 });
+		CHECK(f.count() == 2);
+		CHECK(Filter(pa).between(5.0 * Pressure::bar, 6.0 * Pressure::bar).count() == 2);
+	}
+
+	SECTION("Equality and inequality")
+	{
+		CHECK(Filter(pa).where(Comparison::Equal, 5.0 * Pressure::bar).select() == std::vector<size_t>{ 1 });
+		CHECK(Filter(pa).where(Comparison::NotEqual, 5.0 * Pressure::bar).select() == std::vector<size_t>{ 0, 2, 3 });
+	}
+
+	SECTION("Tolerance is explicit")
+	{
+		const QuantityArray col(std::vector<double>{ 1.0, 1.0 + 1e-9, 1.1 }, m);
+
+		CHECK(Filter(col).where(Comparison::Equal, 1.0 * m).count() == 1);
+		CHECK(Filter(col, Tolerance(1e-6)).where(Comparison::Equal, 1.0 * m).count() == 2);
+		CHECK(Filter(col, Tolerance(0.0, 0.2)).where(Comparison::Greater, 1.0 * m).count() == 0);
+	}
+
+	SECTION("Bitmask layout")
+	{
+		std::vector<double> data(130, 0.0);
+		data[0] = data[64] = data[129] = 1.0;
+
+		const std::vector<uint64_t> bits = Filter(data.data(), data.size(), s).where(Comparison::Greater, 0.5 * s).mask();
+
+		REQUIRE(bits.size() == 3);
+		CHECK(bits[0] == 1);
+		CHECK(bits[1] == 1);
+		CHECK(bits[2] == 2);
+	}
+
+	SECTION("Incompatible thresholds match nothing")
+	{
+		CHECK(Filter(pa).where(Comparison::Greater, 1.0 * m).count() == 0);
+		CHECK(Filter(pa).where(Comparison::NotEqual, 1.0 * s).count() == 0);
+	}
+}
@@ -0,0 +1,116 @@
+#include <string>
+#include <vector>
+
+#include "Units/Units.h"
+#include "Units/IO.h"
+#include "Units/IncrementalParser.h"
+
+#include "catch2/catch.hpp"
+
+using namespace Units;
+
+TEST_CASE("Incremental push parser", "[incremental]")
+{
+	std::vector<Quantity> parsed;
+	const auto collect = [&parsed](const Quantity& q) { parsed.push_back(q); };
+
+	SECTION("Chunks may end anywhere")
+	{
+		const std::string input = u8"12.5 kPa\r\n3e2 µm/s^2\n-7 Ω\n\n42 km";
+		const std::vector<std::string> records = { "12.5 kPa", u8"3e2 µm/s^2", u8"-7 Ω", "42 km" };
+
+		for(size_t split = 0; split <= input.size(); split++)
+		{
+			parsed.clear();
+			IncrementalParser parser(collect);
+
+			parser.feed(input.data(), split);
+			parser.feed(input.data() + split, input.size() - split);
+			CHECK(parser.pending());
+			CHECK(parser.finish() == 1);
+			CHECK_FALSE(parser.pending());
+
+			REQUIRE(parsed.size() == records.size());
+			for(size_t i = 0; i < records.size(); i++)
+			{
+				const Quantity expected = to_quantity(records[i]);
+				CHECK(parsed[i].unit() == expected.unit());
+				CHECK(parsed[i].magnitude() == Approx(expected.magnitude()));
+			}
+		}
+	}
+
+	SECTION("Byte-by-byte feeding")
+	{
+		const std::string input = u8"1 m\n2.75 °C\n1e-3 kg*m/s^2\n";
+		IncrementalParser parser(collect);
+
+		size_t completed = 0;
+		for(char ch : input)
+			completed += parser.feed(&ch, 1);
+
+		CHECK(completed == 3);
+		CHECK(parser.finish() == 0);
+		CHECK(parser.count() == 3);
+
+		REQUIRE(parsed.size() == 3);
+		CHECK(parsed[0].unit() == m);
+		CHECK(parsed[1].magnitude() == Approx(2.75));
+		CHECK(parsed[2].unit() == N);
+		CHECK(parsed[2].magnitude() == Approx(1e-3));
+	}
+
+	SECTION("Custom delimiters")
+	{
+		IncrementalParser parser(collect, ",;");
+
+		CHECK(parser.feed("1 m, 2 s;3") == 2);
+		CHECK(parser.feed(" kg,") == 1);
+		CHECK(parser.finish() == 0);
+
+		REQUIRE(parsed.size() == 3);
+		CHECK(parsed[0].unit() == m);
+		CHECK(parsed[1].unit() == s);
+		CHECK(parsed[2].unit() == kg);
+		CHECK(parsed[2].magnitude() == Approx(3.0));
+	}
+
+	SECTION("Invalid quantities are reported with an error unit")
+	{
+		IncrementalParser parser(collect);
+
+		parser.feed("5 m\n7 xyz\n");
+		REQUIRE(parsed.size() == 2);
+		CHECK(parsed[0].unit() == m);
+		CHECK(parsed[1].unit() == Unit::error());
+	}
+
+	SECTION("Records longer than the maximum are reported once and skipped")
+	{
+		IncrementalParser parser(collect, "\n", 8);
+
+		CHECK(parser.feed("1 m\n12345") == 1);
+		CHECK(parser.feed("6789") == 1);
+		CHECK_FALSE(parser.pending());
+		CHECK(parser.feed(std::string(1000, '9')) == 0);
+		CHECK(parser.feed("9 km\n2 s\n123456789 kg\n3 A") == 2);
+		CHECK(parser.finish() == 1);
+
+		REQUIRE(parsed.size() == 5);
+		CHECK(parsed[0].unit() == m);
+		CHECK(parsed[1].unit() == Unit::error());
+		CHECK(parsed[2].unit() == s);
+		CHECK(parsed[3].unit() == Unit::error());
+		CHECK(parsed[4].unit() == A);
+	}
+
+	SECTION("Blank records are skipped")
+	{
+		IncrementalParser parser(collect);
+
+		CHECK(parser.feed("\n  \n\r\n") == 0);
+		CHECK(parser.finish() == 0);
+		CHECK(parser.count() == 0);
+		CHECK(parsed.empty());
+	}
+}
@@ -1,5 +1,11 @@
+#include <clocale>
+#include <cmath>
+#include <cstdlib>
+#include <sstream>
+
 #include "Units/Units.h"
 #include "Units/IO.h"
+#include "Units/addons/std.h"
 
 #include "catch2/catch.hpp"
 
@@ -42,3 +48,250 @@ TEST_CASE("Unit input parsing", "[unit][input]")
 		temp = Units::to_unit("kat"); CHECK(temp != Units::error); CHECK(temp == Units::kat);
 	}
 }
+
+TEST_CASE("Prefixed unit parsing", "[unit][input]")
+{
+	CHECK(Units::to_unit("km")  == Units::Unit(1e3, Units::m));
+	CHECK(Units::to_unit("dam") == Units::Unit(1e1, Units::m));
+	CHECK(Units::to_unit("daN") == Units::Unit(1e1, Units::N));
+	CHECK(Units::to_unit("mg")  == Units::Unit(1e-6, Units::kg));
+	CHECK(Units::to_unit("g")   == Units::Unit(1e-3, Units::kg));
+	CHECK(Units::to_unit(u8"\u00B5V") == Units::Unit(1e-6, Units::V));
+	CHECK(Units::to_unit(u8"\u03BCV") == Units::Unit(1e-6, Units::V));
+
+	// Whole symbols take precedence over a prefix followed by a unit
+	CHECK(Units::to_unit("dBm") == Units::Log::dBm);
+	CHECK(Units::to_unit("mol") == Units::mol);
+	CHECK(Units::to_unit("Pa")  == Units::Pa);
+
+	// The exponent applies to the prefixed unit
+	CHECK(Units::to_quantity("1 km^2").magnitude() == Approx(1e6));
+	CHECK(Units::to_quantity(u8"1 cm\u00B3").magnitude() == Approx(1e-6));
+
+	// A lone prefix is not a unit
+	CHECK(Units::to_unit("k") == Units::error);
+}
+
+TEST_CASE("Unicode input parsing", "[unit][input]")
+{
+	SECTION("Multi-byte UTF-8 symbols")
+	{
+		CHECK(Units::to_unit(u8"\u2126") == Units::ohm);
+		CHECK(Units::to_unit(u8"m\u00B2") == (Units::m^2));
+		CHECK(Units::to_unit(u8"s\u207B\u00B9") == (Units::s^-1));
+		CHECK(Units::to_unit(u8"\u221AHz") == std::sqrt(Units::Hz));
+
+		CHECK(Units::to_quantity(u8"1 k\u2126").magnitude() == Approx(1000.0));
+		CHECK(Units::to_quantity(u8"1 k\u2126").unit() == Units::ohm);
+		CHECK(Units::to_quantity(u8"1 \u00B5m").magnitude() == Approx(1e-6));
+		CHECK(Units::to_quantity(u8"1 \u03BCm").unit() == Units::m);
+	}
+
+	SECTION("UTF-16 and UTF-32 input")
+	{
+		CHECK(Units::to_unit(u"\u2126") == Units::ohm);
+		CHECK(Units::to_unit(U"m\u00B3") == (Units::m^3));
+
+		const Units::Quantity q = Units::to_quantity(u"12.5 \u00B5s");
+		CHECK(q.magnitude() == Approx(12.5e-6));
+		CHECK(q.unit() == Units::s);
+	}
+
+	SECTION("Quantities")
+	{
+		const Units::Quantity q = Units::to_quantity(u8"9.81 m/s\u00B2");
+		CHECK(q.magnitude() == Approx(9.81));
+		CHECK(q.unit() == Units::m / (Units::s^2));
+	}
+
+	SECTION("Truncated UTF-8 sequences are not read past the end")
+	{
+		CHECK(Units::to_unit("m\xE2\x84") == Units::m);
+		CHECK(Units::to_unit(std::string("\xCE", 1)) == Units::none);
+	}
+}
+
+TEST_CASE("Number parsing", "[quantity][input]")
+{
+	SECTION("Decimal numbers are correctly rounded")
+	{
+		const char* numbers[] = { "0.1", "1.5", "-2.5e3", ".5", "3.", "1e-300", "2.2250738585072014e-308", "12345678901234567890123", "0.000000000000000000000000000001", "9007199254740993" };
+
+		for(const char* number : numbers)
+		{
+			const Units::Quantity q = Units::to_quantity(std::string(number) + " m");
+			CHECK(q.magnitude() == Approx(std::strtod(number, nullptr)).epsilon(0.0));
+			CHECK(q.unit() == Units::m);
+		}
+	}
+
+	SECTION("Special values fall back to the C library")
+	{
+		CHECK(Units::to_quantity("0x10 m").magnitude() == Approx(16.0));
+		CHECK(std::isinf(Units::to_quantity("1e400 m").magnitude()));
+		CHECK(std::isinf(Units::to_quantity("inf m").magnitude()));
+	}
+
+	SECTION("The decimal separator does not depend on the locale")
+	{
+		const char* locales[] = { "de_DE.UTF-8", "de_DE.utf8", "fr_FR.UTF-8", "es_ES.UTF-8" };
+
+		for(const char* locale : locales)
+		{
+			if(std::setlocale(LC_NUMERIC, locale) == nullptr) continue;
+
+			CHECK(Units::to_quantity("1.5 m").magnitude() == Approx(1.5));
+			CHECK(Units::to_quantity("1.5e-300 m").magnitude() == Approx(1.5e-300));
+			break;
+		}
+
+		std::setlocale(LC_NUMERIC, "C");
+	}
+}
+
+TEST_CASE("Stream extraction", "[quantity][input]")
+{
+	SECTION("Several quantities per line")
+	{
+		std::istringstream is(u8"3 m 4.5 km/h -2e3 µV\n(4 cm^2) 7 kg*m/s^2");
+		Units::Quantity q;
+
+		REQUIRE(is >> q); CHECK(q.unit() == Units::m); CHECK(q.magnitude() == Approx(3.0));
+		REQUIRE(is >> q); CHECK(q.unit() == Units::to_quantity("4.5 km/h").unit()); CHECK(q.magnitude() == Approx(Units::to_quantity("4.5 km/h").magnitude()));
+		REQUIRE(is >> q); CHECK(q.unit() == Units::V); CHECK(q.magnitude() == Approx(-2e-3));
+		REQUIRE(is >> q); CHECK(q.unit() == Units::to_quantity("(4 cm^2)").unit()); CHECK(q.magnitude() == Approx(Units::to_quantity("(4 cm^2)").magnitude()));
+		REQUIRE(is >> q); CHECK(q.unit() == Units::N); CHECK(q.magnitude() == Approx(7.0));
+
+		CHECK(is.eof());
+		CHECK_FALSE(is >> q);
+	}
+
+	SECTION("The stream is left after the token")
+	{
+		std::istringstream is("12 s\nnext line");
+		Units::Quantity q;
+		std::string rest;
+
+		REQUIRE(is >> q);
+		CHECK(q.unit() == Units::s);
+
+		std::getline(is, rest);
+		CHECK(rest.empty());
+		std::getline(is, rest);
+		CHECK(rest == "next line");
+	}
+
+	SECTION("Mixed with other extractions")
+	{
+		std::istringstream is("speed: 3 m/s, 10 N");
+		Units::Quantity speed, force;
+		std::string label;
+		char comma;
+
+		REQUIRE(is >> label >> speed >> comma >> force);
+		CHECK(label == "speed:");
+		CHECK(speed.unit() == Units::to_unit("m/s"));
+		CHECK(comma == ',');
+		CHECK(force.unit() == Units::N);
+		CHECK(force.magnitude() == Approx(10.0));
+	}
+
+	SECTION("Units")
+	{
+		std::istringstream is("kg m/s 12");
+		Units::Unit un;
+
+		REQUIRE(is >> un);
+		CHECK(un == Units::to_unit("kg m/s"));
+		CHECK_FALSE(is >> un);
+	}
+
+	SECTION("Invalid input sets the failbit")
+	{
+		std::istringstream is("5 foo");
+		Units::Quantity q;
+
+		CHECK_FALSE(is >> q);
+		CHECK(q.unit() == Units::Unit::error());
+	}
+}
+
+TEST_CASE("Parsing lists of quantities", "[quantity][input]")
+{
+	SECTION("Bracketed lists")
+	{
+		const Units::QuantityArray values = Units::to_quantity_array("[1.2, 3.4, 5.6, 7.8] km/h");
+
+		REQUIRE(values.size() == 4);
+		CHECK(values.unit() == Units::to_quantity("1 km/h").unit());
+		CHECK(values[0] == Units::to_quantity("1.2 km/h"));
+		CHECK(values[3] == Units::to_quantity("7.8 km/h"));
+
+		CHECK(Units::to_quantity_array("[1 2 3] m").magnitudes() == std::vector<double>{ 1.0, 2.0, 3.0 });
+		CHECK(Units::to_quantity_array("  [ -1e3 ,+.5,2 ]mV").size() == 3);
+		CHECK(Units::to_quantity_array("[] s").empty());
+		CHECK(Units::to_quantity_array("[] s").unit() == Units::s);
+	}
+
+	SECTION("Whitespace-separated lists")
+	{
+		const Units::QuantityArray values = Units::to_quantity_array("1.2 3.4 5.6 mV");
+
+		REQUIRE(values.size() == 3);
+		CHECK(values.unit() == Units::V);
+		CHECK(values[1].magnitude() == Approx(3.4e-3));
+
+		const Units::QuantityArray single = Units::to_quantity_array("9.81 m/s^2");
+		REQUIRE(single.size() == 1);
+		CHECK(single[0] == Units::to_quantity("9.81 m/s^2"));
+
+		CHECK(Units::to_quantity_array("1 2 3").unit() == Units::Unit());
+	}
+
+	SECTION("Parsing stops after the unit")
+	{
+		const std::string str = "[1, 2] m/s, 3 kg";
+		Units::QuantityArray values;
+
+		const Units::ParseResult result = Units::parse_quantity_list(str.data(), str.data() + str.size(), values);
+		CHECK(result.ec == std::errc());
+		CHECK(std::string(result.ptr) == ", 3 kg");
+		CHECK(values.size() == 2);
+	}
+
+	SECTION("Invalid lists")
+	{
+		const char* inputs[] = { "", "m", "[1, 2 m", "[1,, 2] m", "[1, 2,] m", "[1, x] m", "1 2 foo", "[1 2] foo" };
+
+		for(const char* input : inputs)
+		{
+			const std::string str = input;
+			Units::QuantityArray values(Units::kg);
+			values.push_back(1.0);
+
+			CHECK(Units::parse_quantity_list(str.data(), str.data() + str.size(), values).ec == std::errc::invalid_argument);
+			CHECK(values.size() == 1);
+			CHECK(values.unit() == Units::kg);
+			CHECK(Units::to_quantity_array(str).unit() == Units::Unit::error());
+		}
+
+		const char* overflowing[] = { "[1, 1e999] m", "[-1e999] m", "1 1e999 m", "1e999" };
+
+		for(const char* input : overflowing)
+		{
+			INFO(input);
+			const std::string str = input;
+			Units::QuantityArray values(Units::kg);
+
+			const Units::ParseResult result = Units::parse_quantity_list(str.data(), str.data() + str.size(), values);
+			CHECK(result.ec == std::errc::result_out_of_range);
+			CHECK(std::string(result.ptr).find_first_of("0123456789") == std::string::npos);
+			CHECK(values.unit() == Units::kg);
+			CHECK(Units::to_quantity_array(str).unit() == Units::Unit::error());
+		}
+
+		const std::string nested = "[1] " + std::string(300, '(') + "m" + std::string(300, ')');
+		Units::QuantityArray values;
+		CHECK(Units::parse_quantity_list(nested.data(), nested.data() + nested.size(), values).ec == std::errc::value_too_large);
+	}
+}
@@ -0,0 +1,103 @@
+#include <string>
+#include <system_error>
+#include <vector>
+
+#include "Units/Units.h"
+#include "Units/IO.h"
+#include "Units/Literals.h"
+
+#include "catch2/catch.hpp"
+
+using namespace Units;
+using namespace Units::literals;
+
+TEST_CASE("Compile-time unit literals", "[literals]")
+{
+	SECTION("Literals are constant expressions")
+	{
+		constexpr Unit newton = "kg*m/s^2"_unit;
+		constexpr Quantity gravity = "9.81 m/s^2"_q;
+		constexpr Unit foot = "ft"_unit;
+
+		static_assert(gravity.magnitude() > 9.8 && gravity.magnitude() < 9.82, "magnitude is computed at compile time");
+
+		CHECK(newton == N);
+		CHECK(foot == ft);
+		CHECK(gravity.unit() == to_unit("m/s^2"));
+		CHECK(gravity.magnitude() == Approx(9.81));
+	}
+
+	SECTION("Every built-in name matches the run-time parser")
+	{
+		std::vector<std::string> names;
+		for(const auto& sym : details::literal::symbols) names.push_back(reinterpret_cast<const char*>(sym.name));
+		for(const auto& sym : details::literal::names) names.push_back(reinterpret_cast<const char*>(sym.name));
+
+		for(const std::string& name : names)
+		{
+			INFO(name);
+			const Unit literal = operator""_unit(name.c_str(), name.size());
+
+			// Some names cannot be read back whole by the parser: at run time,
+			// "B10nV" is parsed as "B" followed by ignored characters. Then the
+			// literal must not accept them either
+			Unit runtime;
+			const char* last = name.c_str() + name.size();
+			const ParseResult res = parse_unit(name.c_str(), last, runtime);
+
+			if(name.empty())
+				CHECK(literal == to_unit(name));
+			else if(res.ec == std::errc() && res.ptr == last)
+				CHECK(literal == runtime);
+			else
+				CHECK(literal == Unit::error());
+		}
+	}
+
+	SECTION("Prefixes, powers and grouping")
+	{
+		const char* units[] =
+		{
+			"km", "mm^2", "kg m/s", "kg*m^2/(A*s^3)", u8"µs", u8"μA", "dam", "g", "mg/m^3", "(4 cm^2)",
+			u8"m²", u8"s⁻¹", u8"km³", u8"Ω", u8"kΩ", u8"√Hz", "dBm", "MHz", "h", "kW*h", "mi/h", "%",
+			"ft", "L", "mL", "bar", "mbar", "min", "kWh", "ft^2", "lb/in^2"
+		};
+
+		for(const char* str : units)
+		{
+			INFO(str);
+			const Unit runtime = to_unit(str);
+			REQUIRE(runtime != Unit::error());
+
+			CHECK(operator""_unit(str, std::string(str).size()) == runtime);
+		}
+	}
+
+	SECTION("Quantities")
+	{
+		const char* quantities[] = { "12.5 kPa", "-3e2 mm/s", "0.001 km", "1 (4 cm^2)", "42 N*m", "2.5e-3 g", "5 ft", "1.5 L", "3 min" };
+
+		for(const char* str : quantities)
+		{
+			INFO(str);
+			const Quantity q = operator""_q(str, std::string(str).size());
+			const Quantity runtime = to_quantity(str);
+
+			CHECK(q.unit() == runtime.unit());
+			CHECK(q.magnitude() == Approx(runtime.magnitude()));
+		}
+	}
+
+	SECTION("Malformed literals are errors at run time")
+	{
+		const std::string malformed[] = { "foo", "m/2", "m^", "(m", "m)", "kg trailing1", "1 m" };
+
+		for(const std::string& str : malformed)
+		{
+			INFO(str);
+			CHECK(operator""_unit(str.c_str(), str.size()) == Unit::error());
+		}
+
+		CHECK(operator""_q("m", 1).unit() == Unit::error());
+	}
+}
@@ -0,0 +1,97 @@
+#include <cstdio>
+#include <string>
+
+#include "Units/Units.h"
+#include "Units/Loader.h"
+
+#include "catch2/catch.hpp"
+
+using namespace Units;
+
+TEST_CASE("Bulk loading of quantities", "[loader]")
+{
+	SECTION("Lines are bucketed by unit in input order")
+	{
+		const std::string input = "12.5 kPa\n3 m/s\r\n\n1 kPa\n  \n-4 m/s\n7 s";
+		const LoadResult result = parse_quantities(input.data(), input.data() + input.size());
+
+		REQUIRE(result.ok);
+		CHECK(result.lines == 7);
+		CHECK(result.errors.empty());
+		REQUIRE(result.columns.size() == 3);
+
+		CHECK(result.columns[0].values.unit() == Pa);
+		REQUIRE(result.columns[0].values.size() == 2);
+		CHECK(result.columns[0].values[0].magnitude() == Approx(12500.0));
+		CHECK(result.columns[0].values[1].magnitude() == Approx(1000.0));
+		CHECK(result.columns[0].lines == std::vector<size_t>{ 1, 4 });
+
+		CHECK(result.columns[1].values.unit() == m / s);
+		CHECK(result.columns[1].values[1].magnitude() == Approx(-4.0));
+		CHECK(result.columns[1].lines == std::vector<size_t>{ 2, 6 });
+
+		CHECK(result.columns[2].values.unit() == s);
+		CHECK(result.columns[2].lines == std::vector<size_t>{ 7 });
+	}
+
+	SECTION("Invalid lines are reported with their position")
+	{
+		const std::string input = "1 m\nfoo\n2 xyz\n3 m\n";
+		const LoadResult result = parse_quantities(input.data(), input.data() + input.size());
+
+		CHECK(result.lines == 4);
+		REQUIRE(result.errors.size() == 2);
+		CHECK(result.errors[0].line == 2);
+		CHECK(result.errors[0].offset == 4);
+		CHECK(result.errors[1].line == 3);
+		CHECK(result.errors[1].offset == 8);
+
+		REQUIRE(result.columns.size() == 1);
+		CHECK(result.columns[0].lines == std::vector<size_t>{ 1, 4 });
+	}
+
+	SECTION("Chunked parallel parsing gives the same result")
+	{
+		std::string input;
+		for(int i = 0; i < 5000; i++)
+			input += std::to_string(i) + (i % 3 == 0 ? " m\n" : (i % 3 == 1 ? " s\n" : " bad\n"));
+
+		const LoadResult serial = parse_quantities(input.data(), input.data() + input.size(), LoadOptions(1));
+		const LoadResult parallel = parse_quantities(input.data(), input.data() + input.size(), LoadOptions(4, 100));
+
+		CHECK(parallel.lines == 5000);
+		CHECK(parallel.lines == serial.lines);
+		REQUIRE(parallel.columns.size() == 2);
+		REQUIRE(parallel.errors.size() == serial.errors.size());
+		CHECK(parallel.errors.back().line == serial.errors.back().line);
+
+		for(size_t c = 0; c < 2; c++)
+		{
+			CHECK(parallel.columns[c].values.magnitudes() == serial.columns[c].values.magnitudes());
+			CHECK(parallel.columns[c].lines == serial.columns[c].lines);
+		}
+
+		CHECK(parallel.columns[0].lines[1] == 4);
+		CHECK(parallel.columns[0].values[1].magnitude() == Approx(3.0));
+	}
+
+	SECTION("Files are memory-mapped")
+	{
+		const char* path = "Loader.test.txt";
+
+		std::FILE* file = std::fopen(path, "wb");
+		REQUIRE(file != nullptr);
+		std::fputs("1.5 kg\n2.5 kg\n", file);
+		std::fclose(file);
+
+		const LoadResult result = load_quantities(path);
+		std::remove(path);
+
+		REQUIRE(result.ok);
+		REQUIRE(result.columns.size() == 1);
+		CHECK(result.columns[0].values.size() == 2);
+		CHECK(result.columns[0].values[1].magnitude() == Approx(2.5));
+
+		CHECK_FALSE(load_quantities("this/file/does/not/exist.txt").ok);
+	}
+}
@@ -0,0 +1,66 @@
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#include "Units/Units.h"
+#include "Units/Parallel.h"
+
+#include "catch2/catch.hpp"
+
+using namespace Units;
+
+static uint64_t bits(const Quantity& q)
+{
+	const double mag = q.magnitude();
+	uint64_t ret;
+	std::memcpy(&ret, &mag, sizeof(ret));
+	return ret;
+}
+
+TEST_CASE("Parallel reductions", "[parallel]")
+{
+	std::vector<double> data;
+	for(int i = 0; i < 100000; i++)
+		data.push_back((i % 3 == 0 ? 1e10 : 1e-3) * (double)((i * 7919) % 1013) * (i % 2 == 0 ? 1.0 : -1.0));
+
+	const QuantityArray column(data, J);
+
+	SECTION("Deterministic results do not depend on the amount of threads")
+	{
+		const Quantity reference = Stats::parallel_sum(column, ReductionOptions(1, 1000));
+
+		for(unsigned threads : { 2u, 3u, 4u, 7u, 16u })
+			CHECK(bits(Stats::parallel_sum(column, ReductionOptions(threads, 1000))) == bits(reference));
+
+		CHECK(reference.unit() == J);
+	}
+
+	SECTION("Fast mode agrees with the deterministic mode")
+	{
+		const Quantity det  = Stats::parallel_sum(column, ReductionOptions(4, 1000, true));
+		const Quantity fast = Stats::parallel_sum(column, ReductionOptions(4, 1000, false));
+
+		CHECK(fast.magnitude() == Approx(det.magnitude()));
+	}
+
+	SECTION("Ranges of quantities are normalized per chunk")
+	{
+		std::vector<Quantity> values;
+		for(int i = 0; i < 10000; i++)
+			values.push_back(i % 2 == 0 ? Quantity(1.0, Unit(1000.0, m)) : Quantity(1000.0, m));
+
+		const Quantity total = Stats::parallel_sum(values, ReductionOptions(3, 128));
+		CHECK(total.unit() == Unit(1000.0, m));
+		CHECK(total.magnitude() == Approx(10000.0));
+		CHECK(Stats::parallel_mean(values, ReductionOptions(3, 128)).magnitude() == Approx(1.0));
+
+		values.push_back(1.0 * s);
+		CHECK(Stats::parallel_sum(values, ReductionOptions(3, 128)).unit() == error);
+	}
+
+	SECTION("Empty inputs")
+	{
+		CHECK(Stats::parallel_sum(QuantityArray(m)) == 0.0 * m);
+		CHECK(std::isnan(Stats::parallel_mean(std::vector<Quantity>()).magnitude()));
+	}
+}
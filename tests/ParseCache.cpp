@@ -0,0 +1,108 @@
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "Units/Units.h"
+#include "Units/IO.h"
+#include "Units/ParseCache.h"
+#include "Units/Registry.h"
+
+#include "catch2/catch.hpp"
+
+using namespace Units;
+
+TEST_CASE("Memoizing parse cache", "[cache]")
+{
+	SECTION("Results match the uncached parser")
+	{
+		ParseCache cache;
+		const char* units[] = { "m", "km", "m/s^2", "kg*m/s^2", u8"µV", "dBm", "N m", "(4 cm^2)", "foo" };
+
+		for(int pass = 0; pass < 2; pass++)
+		{
+			for(const char* str : units)
+			{
+				CHECK(cache.to_unit(str) == to_unit(str));
+
+				const std::string quantity = std::string("12.5 ") + str;
+				CHECK(cache.to_quantity(quantity).unit() == to_quantity(quantity).unit());
+				CHECK(cache.to_quantity(quantity).magnitude() == Approx(to_quantity(quantity).magnitude()));
+			}
+		}
+	}
+
+	SECTION("Quantities only cache the unit suffix")
+	{
+		ParseCache cache;
+
+		for(int i = 0; i < 100; i++)
+		{
+			const Quantity q = cache.to_quantity(std::to_string(i) + " kPa");
+			CHECK(q.magnitude() == Approx(1000.0 * i));
+		}
+
+		CHECK(cache.size() == 1);
+		CHECK(cache.statistics().misses == 1);
+		CHECK(cache.statistics().hits == 99);
+	}
+
+	SECTION("Units registered later are picked up")
+	{
+		ParseCache cache;
+
+		CHECK(cache.to_unit("cachegpm") == Unit::error());
+		CHECK(cache.to_quantity("3 cachegpm").unit() == Unit::error());
+
+		const Unit gpm = Unit(3.785411784e-3f / 60.0f, (m^3) / s);
+		REQUIRE(register_unit("cachegpm", gpm));
+
+		CHECK(cache.to_unit("cachegpm") == gpm);
+		CHECK(cache.to_quantity("3 cachegpm").unit() == to_quantity("3 cachegpm").unit());
+	}
+
+	SECTION("Capacity is bounded")
+	{
+		ParseCache cache(4, 1);
+
+		const char* units[] = { "m", "s", "kg", "A", "K", "mol" };
+		for(const char* str : units) cache.to_unit(str);
+
+		CHECK(cache.size() == 4);
+		CHECK(cache.statistics().evictions == 2);
+
+		// Recently used strings survive the next eviction
+		cache.to_unit("mol");
+		cache.to_unit("Hz");
+		CHECK(cache.statistics().hits == 1);
+		cache.to_unit("mol");
+		CHECK(cache.statistics().hits == 2);
+
+		cache.clear();
+		CHECK(cache.size() == 0);
+	}
+
+	SECTION("Concurrent use")
+	{
+		ParseCache cache(64, 4);
+		const char* units[] = { "m", "s", "kWh", "m/s", "Pa", "Hz", "V", "mA" };
+		std::vector<std::thread> threads;
+		std::vector<int> errors(4, 0);
+
+		for(size_t t = 0; t < 4; t++)
+		{
+			threads.emplace_back([&, t] {
+				for(int i = 0; i < 2000; i++)
+				{
+					const char* str = units[(size_t)i % 8];
+					if(cache.to_unit(str) != to_unit(str)) errors[t]++;
+				}
+			});
+		}
+
+		for(std::thread& thread : threads) thread.join();
+
+		for(int e : errors) CHECK(e == 0);
+		CHECK(cache.statistics().hits + cache.statistics().misses == 8000);
+		CHECK(cache.size() <= 8);
+	}
+}
@@ -0,0 +1,194 @@
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <string>
+#include <system_error>
+
+#include "Units/Units.h"
+#include "Units/IO.h"
+
+#include "catch2/catch.hpp"
+
+using namespace Units;
+
+static size_t allocations = 0;
+
+void* operator new(size_t size)
+{
+	allocations++;
+
+	void* ptr = std::malloc(size == 0 ? 1 : size);
+	if(ptr == nullptr) throw std::bad_alloc();
+	return ptr;
+}
+
+void operator delete(void* ptr) noexcept { std::free(ptr); }
+void operator delete(void* ptr, size_t) noexcept { std::free(ptr); }
+
+static ParseResult parse(const std::string& str, Quantity& out) { return parse_quantity(str.data(), str.data() + str.size(), out); }
+static ParseResult parse(const std::string& str, Unit& out)     { return parse_unit    (str.data(), str.data() + str.size(), out); }
+
+TEST_CASE("Parsing with error positions", "[quantity][input]")
+{
+	SECTION("Successful parses report the consumed length")
+	{
+		const std::string str = "9.81 m/s^2, 3 kg";
+		Quantity q;
+
+		const ParseResult result = parse(str, q);
+		CHECK(result.ec == std::errc());
+		CHECK(result.ptr == str.data() + 10);
+		CHECK(q.unit() == to_unit("m/s^2"));
+		CHECK(q.magnitude() == Approx(9.81));
+
+		const ParseResult next = parse_quantity(result.ptr + 1, str.data() + str.size(), q);
+		CHECK(next.ec == std::errc());
+		CHECK(next.ptr == str.data() + str.size());
+		CHECK(q.unit() == kg);
+	}
+
+	SECTION("Parsing stops before the next quantity")
+	{
+		const std::string str = "3 m 4 s";
+		Quantity q;
+
+		const ParseResult result = parse(str, q);
+		CHECK(result.ec == std::errc());
+		CHECK(std::string(result.ptr) == "4 s");
+		CHECK(q.unit() == m);
+	}
+
+	SECTION("Failures report where they happened")
+	{
+		Quantity q = 7.0 * s;
+
+		std::string str = "12 m/foo";
+		ParseResult result = parse(str, q);
+		CHECK(result.ec == std::errc::invalid_argument);
+		CHECK(result.ptr == str.data() + 5);
+
+		str = "  m/s";
+		result = parse(str, q);
+		CHECK(result.ec == std::errc::invalid_argument);
+		CHECK(result.ptr == str.data() + 2);
+
+		str = "1 (4 cm^2";
+		result = parse(str, q);
+		CHECK(result.ec == std::errc::invalid_argument);
+		CHECK(result.ptr == str.data() + str.size());
+
+		str = "1e400 m";
+		result = parse(str, q);
+		CHECK(result.ec == std::errc::result_out_of_range);
+		CHECK(result.ptr == str.data() + 5);
+
+		// The output is left untouched
+		CHECK(q.unit() == s);
+		CHECK(q.magnitude() == Approx(7.0));
+	}
+
+	SECTION("Units")
+	{
+		const std::string str = "kg*m^2/s^3, rest";
+		Unit un = m;
+
+		ParseResult result = parse(str, un);
+		CHECK(result.ec == std::errc());
+		CHECK(std::string(result.ptr) == ", rest");
+		CHECK(un == W);
+
+		un = m;
+		result = parse(std::string("kg/xyz"), un);
+		CHECK(result.ec == std::errc::invalid_argument);
+		CHECK(un == m);
+
+		result = parse(std::string(""), un);
+		CHECK(result.ec == std::errc::invalid_argument);
+	}
+
+	SECTION("No heap allocations")
+	{
+		const std::string inputs[] =
+		{
+			"12.5 kPa", u8"-3e2 µm/s^2", "1 (4 cm^2)", "2 N*m", "5 foo", "1e400 m",
+			"0.1234567890123456789012345678901234567890123456789012345678901234567890123456789 m"
+		};
+
+		for(const std::string& str : inputs)
+		{
+			Quantity q;
+			Unit un;
+
+			const size_t before = allocations;
+			parse_quantity(str.data(), str.data() + str.size(), q);
+			parse_unit(str.data(), str.data() + str.size(), un);
+			CHECK(allocations == before);
+		}
+	}
+}
+
+TEST_CASE("Parsing limits", "[quantity][input]")
+{
+	const size_t levels = 100000;
+	const std::string nested = "1 " + std::string(levels, '(') + "m" + std::string(levels, ')');
+
+	SECTION("Deep nesting does not overflow the stack")
+	{
+		Quantity q;
+		ParseResult result = parse(nested, q);
+		CHECK(result.ec == std::errc::value_too_large);
+		CHECK(result.ptr == nested.data() + 2 + 257);
+		CHECK(to_quantity(nested).unit() == Unit::error());
+
+		result = parse_quantity(nested.data(), nested.data() + nested.size(), q, ParseLimits(levels));
+		CHECK(result.ec == std::errc());
+		CHECK(result.ptr == nested.data() + nested.size());
+		CHECK(q == 1.0 * m);
+
+		Unit un;
+		CHECK(parse_unit(nested.data() + 2, nested.data() + nested.size(), un, ParseLimits(levels - 1)).ec == std::errc::value_too_large);
+		CHECK(parse_unit(nested.data() + 2, nested.data() + nested.size(), un, ParseLimits(levels)).ec == std::errc());
+		CHECK(un == m);
+	}
+
+	SECTION("Unbalanced parentheses")
+	{
+		const std::string open = "1 " + std::string(levels, '(') + "m";
+		Quantity q;
+
+		CHECK(parse_quantity(open.data(), open.data() + open.size(), q, ParseLimits(levels)).ec == std::errc::invalid_argument);
+		CHECK(parse(std::string("3 (m/s))"), q).ec == std::errc());
+	}
+
+	SECTION("Nested expressions keep their meaning")
+	{
+		CHECK(to_quantity("45 m / (10 s)") == 4.5 * m / s);
+		CHECK(to_quantity("2 (3 (4 m) s)") == 24.0 * m * s);
+		CHECK(to_quantity("1 ((m)/(s))") == 1.0 * m / s);
+		CHECK(to_quantity("1 (m") == Unit::error());
+	}
+
+	SECTION("Length limit")
+	{
+		const std::string str = "12.5 kPa";
+		Quantity q;
+		Unit un;
+
+		ParseResult result = parse_quantity(str.data(), str.data() + str.size(), q, ParseLimits(256, 4));
+		CHECK(result.ec == std::errc::value_too_large);
+		CHECK(result.ptr == str.data() + 4);
+
+		CHECK(parse_quantity(str.data(), str.data() + str.size(), q, ParseLimits(256, str.size())).ec == std::errc());
+		CHECK(parse_unit(str.data() + 5, str.data() + str.size(), un, ParseLimits(256, 2)).ec == std::errc::value_too_large);
+	}
+
+	SECTION("Shallow nesting does not use the heap")
+	{
+		const std::string str = "1 " + std::string(32, '(') + "m" + std::string(32, ')');
+		Quantity q;
+
+		const size_t before = allocations;
+		CHECK(parse(str, q).ec == std::errc());
+		CHECK(allocations == before);
+	}
+}
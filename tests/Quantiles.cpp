@@ -0,0 +1,100 @@
+#include <thread>
+#include <vector>
+
+#include "Units/Units.h"
+#include "Units/QuantileSketch.h"
+
+#include "catch2/catch.hpp"
+
+using namespace Units;
+
+TEST_CASE("Quantile sketches", "[sketch]")
+{
+	const Unit ms = Unit(milli, s);
+
+	SECTION("Unit is fixed on first insert and other units are normalized")
+	{
+		QuantileSketch sketch;
+		CHECK(sketch.insert(500.0 * ms));
+		CHECK(sketch.insert(1.0 * s));
+		CHECK_FALSE(sketch.insert(1.0 * m));
+
+		CHECK(sketch.unit() == ms);
+		CHECK(sketch.count() == Approx(2.0));
+		CHECK(sketch.max().magnitude() == Approx(1000.0));
+	}
+
+	SECTION("Quantiles of a uniform distribution")
+	{
+		QuantileSketch sketch(ms);
+		for(int i = 1; i <= 100000; i++)
+			sketch.insert(i % 2 == 0 ? Quantity((double)i / 100.0, ms) : Quantity((double)i / 100000.0, s));
+
+		CHECK(sketch.quantile(0.0).magnitude() == Approx(0.01));
+		CHECK(sketch.quantile(0.5).magnitude() == Approx(500.0).epsilon(0.01));
+		CHECK(sketch.quantile(0.99).magnitude() == Approx(990.0).epsilon(0.001));
+		CHECK(sketch.quantile(1.0).magnitude() == Approx(1000.0));
+		CHECK(sketch.quantile(0.99, s).magnitude() == Approx(0.99).epsilon(0.001));
+		CHECK(sketch.quantile(0.5, m).unit() == error);
+	}
+
+	SECTION("Sketches are mergeable")
+	{
+		QuantileSketch a(ms), b(s), c(Data::byte);
+		for(int i = 0; i < 5000; i++)
+		{
+			a.insert((double)i);
+			b.insert((double)(5000 + i) / 1000.0);
+		}
+
+		REQUIRE(a.merge(b));
+		CHECK_FALSE(a.merge(c) == false); // Empty sketches are always mergeable
+		c.insert(1.0);
+		CHECK_FALSE(a.merge(c));
+
+		CHECK(a.count() == Approx(10000.0));
+		CHECK(a.quantile(0.5).magnitude() == Approx(5000.0).epsilon(0.01));
+		CHECK(a.quantile(0.9).magnitude() == Approx(9000.0).epsilon(0.01));
+	}
+
+	SECTION("A sketch can be merged into itself")
+	{
+		QuantileSketch sketch(s);
+		for(int i = 0; i < 1000; i++) sketch.insert((double)i);
+
+		REQUIRE(sketch.merge(sketch));
+		CHECK(sketch.count() == Approx(2000.0));
+		CHECK(sketch.quantile(0.5).magnitude() == Approx(500.0).epsilon(0.02));
+		CHECK(sketch.max().magnitude() == Approx(999.0));
+	}
+
+	SECTION("Queries do not modify the sketch")
+	{
+		QuantileSketch sketch(s);
+		for(int i = 0; i < 100; i++) sketch.insert((double)i);
+
+		const QuantileSketch& view = sketch;
+		std::vector<double> medians(4, 0.0);
+		std::vector<std::thread> threads;
+		for(size_t t = 0; t < medians.size(); t++)
+			threads.emplace_back([&view, &medians, t]() { for(int i = 0; i < 100; i++) medians[t] = view.quantile(0.5).magnitude(); });
+
+		for(std::thread& thread : threads) thread.join();
+
+		for(double median : medians) CHECK(median == Approx(49.5).epsilon(0.02));
+	}
+
+	SECTION("Memory is bounded")
+	{
+		QuantileSketch sketch(50.0);
+		for(int i = 0; i < 200000; i++) sketch.insert((double)((i * 7919) % 100000));
+
+		CHECK(sketch.quantile(0.25).magnitude() == Approx(25000.0).epsilon(0.02));
+	}
+
+	SECTION("Empty sketches return NaN")
+	{
+		QuantileSketch sketch(ms);
+		CHECK(std::isnan(sketch.quantile(0.5).magnitude()));
+	}
+}
@@ -0,0 +1,158 @@
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "Units/Units.h"
+#include "Units/IO.h"
+#include "Units/Registry.h"
+
+#include "catch2/catch.hpp"
+
+using namespace Units;
+
+TEST_CASE("Unit registry", "[registry]")
+{
+	SECTION("Built-in names are shared by the parser and the formatter")
+	{
+		CHECK(to_unit("ft") == ft);
+		CHECK(to_string(ft) == "ft");
+		CHECK(to_unit("mi") == i::mile);
+		CHECK(to_string(i::mile) == "mi");
+		CHECK(to_unit("bar") == Pressure::bar);
+		CHECK(to_unit("kbar") == Unit(1000.0, Pressure::bar));
+	}
+
+	SECTION("Registered units can be parsed and formatted")
+	{
+		const Unit gpm = Unit(3.785411784e-3f / 60.0f, (m^3) / s);
+
+		CHECK(to_unit("gpm") == Unit::error());
+		REQUIRE(register_unit("gpm", gpm));
+
+		CHECK(to_unit("gpm") == gpm);
+		CHECK(to_unit("kgpm") == Unit(1000.0, gpm));
+		CHECK(to_quantity("12 gpm").unit() == gpm);
+		CHECK(to_quantity("12 gpm").magnitude() == Approx(12.0));
+		CHECK(to_string(gpm) == "gpm");
+	}
+
+	SECTION("Flags select the direction")
+	{
+		const Unit parseOnly  = Unit(7.0, kg);
+		const Unit formatOnly = Unit(11.0, kg);
+
+		REQUIRE(register_units({ { "pnly", parseOnly, UNIT_PARSE }, { "fnly", formatOnly, UNIT_FORMAT } }));
+
+		CHECK(to_unit("pnly") == parseOnly);
+		CHECK(to_string(parseOnly) != "pnly");
+		CHECK(to_unit("fnly") == Unit::error());
+		CHECK(to_string(formatOnly) == "fnly");
+	}
+
+	SECTION("Registering again replaces earlier names")
+	{
+		const Unit first  = Unit(2.0, A);
+		const Unit second = Unit(3.0, A);
+
+		REQUIRE(register_unit("twice", first));
+		REQUIRE(register_unit("twice", second));
+		CHECK(to_unit("twice") == second);
+
+		REQUIRE(register_unit("thrice", second, UNIT_FORMAT));
+		CHECK(to_string(second) == "thrice");
+
+		// Symbols of the parser take precedence, so they cannot be replaced
+		CHECK_FALSE(register_unit("m", second, UNIT_PARSE));
+		CHECK_FALSE(register_unit("mi", Unit(1000.0, m)));
+		CHECK_FALSE(register_unit("h", Unit(100.0, s)));
+		CHECK(to_unit("m") == m);
+		CHECK(to_unit("mi") == mile);
+		CHECK(to_unit("h") == h);
+
+		// Unless they keep their unit, or are only used for formatting
+		CHECK(register_unit("h", h));
+		CHECK(register_unit("m", second, UNIT_FORMAT));
+
+		// Other built-in names can be replaced
+		const Unit survey = Unit(1200.0 / 3937.0, m);
+		REQUIRE(register_unit("ft", survey, UNIT_PARSE));
+		CHECK(to_unit("ft") == survey);
+		REQUIRE(register_unit("ft", ft, UNIT_PARSE));
+	}
+
+	SECTION("Formatted units follow later registrations")
+	{
+		const Unit un = Unit(13.0, kg * A);
+
+		CHECK(to_string(un) == "???");
+		CHECK(to_string(un) == "???");
+
+		REQUIRE(register_unit("thirteen", un, UNIT_FORMAT));
+		CHECK(to_string(un) == "thirteen");
+		CHECK(to_string(2.0 * un) == "2.000 thirteen");
+	}
+
+	SECTION("Formatting from several threads")
+	{
+		const Unit units[] = { m, m / s, kg * (m^2), Unit(1e3, m) / h, Unit(17.0, A * K), ft / s, N * m, W / (m^2) };
+
+		std::vector<std::string> expected;
+		for(const Unit& un : units) expected.push_back(to_string(un));
+
+		std::atomic<int> failures(0);
+		std::vector<std::thread> threads;
+
+		for(int t = 0; t < 4; t++)
+		{
+			threads.emplace_back([&, t] {
+				for(int i = 0; i < 2000; i++)
+				{
+					const size_t index = (size_t)(i + t) % expected.size();
+					if(to_string(units[index]) != expected[index]) failures++;
+				}
+			});
+		}
+
+		for(std::thread& thread : threads) thread.join();
+		CHECK(failures.load() == 0);
+	}
+
+	SECTION("Invalid definitions are rejected")
+	{
+		CHECK_FALSE(register_unit("", m));
+		CHECK_FALSE(register_unit("bad", Unit::error()));
+		CHECK_FALSE(register_unit("bad", m, 0));
+		CHECK_FALSE(register_units({ { "ok", m, UNIT_PARSE }, { "", m, UNIT_PARSE } }));
+		CHECK(to_unit("ok") == Unit::error());
+	}
+
+	SECTION("Readers run concurrently with writers")
+	{
+		std::atomic<bool> done(false);
+		std::atomic<int> failures(0);
+		std::vector<std::thread> readers;
+
+		for(int t = 0; t < 3; t++)
+		{
+			readers.emplace_back([&] {
+				while(!done)
+				{
+					if(to_unit("ft") != ft || to_string(ft) != "ft") failures++;
+				}
+			});
+		}
+
+		for(int i = 0; i < 50; i++)
+		{
+			const std::string name = std::string("vendor") + (char)('a' + i / 26) + (char)('a' + i % 26);
+			CHECK(register_unit(name, Unit((float)(i + 1), currency), UNIT_PARSE));
+		}
+
+		done = true;
+		for(std::thread& t : readers) t.join();
+
+		CHECK(failures.load() == 0);
+		CHECK(to_unit("vendorbx") == Unit(50.0, currency));
+	}
+}
@@ -0,0 +1,161 @@
+#include <string>
+
+#include "Units/Units.h"
+#include "Units/IO.h"
+#include "Units/Scanner.h"
+
+#include "catch2/catch.hpp"
+
+using namespace Units;
+
+static std::vector<QuantityMatch> scan(const std::string& text, const ScanOptions& options = ScanOptions())
+{
+	return scan_quantities(text.data(), text.data() + text.size(), options);
+}
+
+static std::string matched(const std::string& text, const QuantityMatch& match)
+{
+	return text.substr(match.offset, match.length);
+}
+
+TEST_CASE("Scanning text for quantities", "[scanner]")
+{
+	SECTION("Quantities in a log line")
+	{
+		const std::string line = "req=42 latency=12.3 ms size=4 KiB gain=4.1 dB";
+		const std::vector<QuantityMatch> found = scan(line);
+
+		REQUIRE(found.size() == 2);
+		CHECK(matched(line, found[0]) == "12.3 ms");
+		CHECK(found[0].quantity.unit() == s);
+		CHECK(found[0].quantity.magnitude() == Approx(0.0123));
+
+		CHECK(matched(line, found[1]) == "4.1 dB");
+		CHECK(found[1].quantity == to_quantity("4.1 dB"));
+	}
+
+	SECTION("Offsets and values match the parser")
+	{
+		const std::string text = "g = 9.81 m/s^2, T=-40degC; drift -3.5e-3 mV/h.";
+		const std::vector<QuantityMatch> found = scan(text);
+
+		REQUIRE(found.size() == 2);
+		CHECK(found[0].offset == 4);
+		CHECK(matched(text, found[0]) == "9.81 m/s^2");
+		CHECK(found[0].quantity == to_quantity("9.81 m/s^2"));
+
+		CHECK(matched(text, found[1]) == "-3.5e-3 mV/h");
+		CHECK(found[1].quantity == to_quantity("-3.5e-3 mV/h"));
+	}
+
+	SECTION("Compact and Unicode units")
+	{
+		const std::string text = u8"5ms 20µs 3 m² 100%";
+		const std::vector<QuantityMatch> found = scan(text);
+
+		REQUIRE(found.size() == 4);
+		CHECK(matched(text, found[0]) == "5ms");
+		CHECK(matched(text, found[1]) == u8"20µs");
+		CHECK(found[1].quantity == to_quantity(u8"20µs"));
+		CHECK(matched(text, found[2]) == u8"3 m²");
+		CHECK(found[2].quantity.unit() == (m^2));
+		CHECK(matched(text, found[3]) == "100%");
+	}
+
+	SECTION("Numbers that are not quantities are skipped")
+	{
+		const std::string text = "x86 v1.2 1.2.3 ms 0x1F s 7 apples 12 mins 3  m id_4 s";
+		CHECK(scan(text).empty());
+	}
+
+	SECTION("Numbers with digit groups or a decimal comma are skipped")
+	{
+		const std::string text = "took 1,000 ms, then 3,5 ms and 1,000,000 ns; 1, 2 ms";
+		const std::vector<QuantityMatch> found = scan(text);
+
+		REQUIRE(found.size() == 1);
+		CHECK(matched(text, found[0]) == "2 ms");
+	}
+
+	SECTION("Bytes and binary prefixes are not units")
+	{
+		const std::string text = "size=4 KiB total=4 kB";
+		const std::vector<QuantityMatch> found = scan(text);
+
+		// `B` is the bel, so `kB` is a kilobel
+		REQUIRE(found.size() == 1);
+		CHECK(matched(text, found[0]) == "4 kB");
+		CHECK(found[0].quantity.unit() == Log::B);
+	}
+
+	SECTION("English words are units unless whitelisted")
+	{
+		const std::string text = "found 3 in the list, 10 at once, 5 a day, 12 ms";
+		const std::vector<QuantityMatch> found = scan(text);
+
+		REQUIRE(found.size() == 4);
+		CHECK(found[0].quantity.unit() == in);
+		CHECK(found[1].quantity.unit() == GM::at);
+		CHECK(found[2].quantity.unit() == Area::are);
+
+		const std::vector<QuantityMatch> whitelisted = scan(text, ScanOptions({ "ms" }));
+		REQUIRE(whitelisted.size() == 1);
+		CHECK(matched(text, whitelisted[0]) == "12 ms");
+	}
+
+	SECTION("Trailing punctuation is not part of the unit")
+	{
+		const std::string text = "(5 m), 6 kg. 7 m/ 2";
+		const std::vector<QuantityMatch> found = scan(text);
+
+		REQUIRE(found.size() == 3);
+		CHECK(matched(text, found[0]) == "5 m");
+		CHECK(matched(text, found[1]) == "6 kg");
+		CHECK(matched(text, found[2]) == "7 m");
+	}
+
+	SECTION("Whitelist of units")
+	{
+		const std::string text = "a=1 ms b=2 s c=3 mV d=4 ms";
+		const std::vector<QuantityMatch> found = scan(text, ScanOptions({ "ms", "mV" }));
+
+		REQUIRE(found.size() == 3);
+		CHECK(matched(text, found[0]) == "1 ms");
+		CHECK(matched(text, found[1]) == "3 mV");
+		CHECK(matched(text, found[2]) == "4 ms");
+	}
+
+	SECTION("Long inputs")
+	{
+		std::string text;
+		for(int i = 0; i < 1000; i++)
+			text += "ts=2021-05-04T10:00:00 user=bob latency=" + std::to_string(i) + " ms status=ok\n";
+
+		const std::vector<QuantityMatch> found = scan(text);
+
+		REQUIRE(found.size() == 1000);
+		for(size_t i = 0; i < found.size(); i++)
+			CHECK(found[i].quantity.magnitude() == Approx(0.001 * (double)i));
+	}
+
+	SECTION("Quantities across block boundaries")
+	{
+		for(size_t pad = 50; pad < 140; pad++)
+		{
+			const std::string text = std::string(pad, ' ') + "12.5 ms";
+			const std::vector<QuantityMatch> found = scan(text);
+
+			REQUIRE(found.size() == 1);
+			CHECK(found[0].offset == pad);
+			CHECK(found[0].length == 7);
+
+			CHECK(scan(std::string(pad, 'a') + "12.5 ms").empty());
+		}
+	}
+
+	SECTION("Empty input")
+	{
+		CHECK(scan("").empty());
+		CHECK(scan("no numbers here").empty());
+	}
+}
@@ -0,0 +1,127 @@
+#include <cmath>
+
+#include "Units/Units.h"
+#include "Units/QuantitySeries.h"
+
+#include "catch2/catch.hpp"
+
+using namespace Units;
+
+TEST_CASE("Quantity arrays", "[array]")
+{
+	SECTION("Quantities are converted to the unit of the array")
+	{
+		QuantityArray arr(m);
+		arr.push_back(1.0 * km);
+		arr.push_back(Quantity(2.0, m));
+
+		CHECK(arr.size() == 2);
+		CHECK(arr[0] == 1000.0 * m);
+		CHECK(arr[1] == 2.0 * m);
+	}
+
+	SECTION("Incompatible quantities are stored as NaN")
+	{
+		QuantityArray arr(m);
+		arr.push_back(Quantity(3.0, s));
+		CHECK(std::isnan(arr.data()[0]));
+	}
+
+	SECTION("Whole arrays can be converted")
+	{
+		QuantityArray arr(std::vector<double>{ 1.0, 2.5 }, Unit(1000.0, m));
+		QuantityArray conv = arr.convert(m);
+
+		CHECK(conv.unit() == m);
+		CHECK(conv[1] == 2500.0 * m);
+		CHECK(arr.convert(s).unit() == error);
+	}
+}
+
+TEST_CASE("Quantity series calculus", "[series]")
+{
+	SECTION("Derivative of a counter is a rate")
+	{
+		QuantitySeries series(s, Data::byte);
+		series.push_back(0.0 * s, 0.0 * Data::byte);
+		series.push_back(1.0 * s, 100.0 * Data::byte);
+		series.push_back(3.0 * s, 500.0 * Data::byte);
+
+		QuantitySeries rate = series.derivative();
+
+		REQUIRE(rate.size() == 2);
+		CHECK(rate.values().unit() == Data::byte / s);
+		CHECK(rate.values()[0] == 100.0 * Data::byte / s);
+		CHECK(rate.values()[1] == 200.0 * Data::byte / s);
+		CHECK(rate.time()[1] == 3.0 * s);
+	}
+
+	SECTION("Integral of power over time is energy")
+	{
+		QuantitySeries series(h, W);
+		series.push_back(0.0 * h, 100.0 * W);
+		series.push_back(1.0 * h, 100.0 * W);
+		series.push_back(2.0 * h, 300.0 * W);
+
+		Quantity energy = series.integral();
+		CHECK(energy.unit() == Energy::Wh);
+		CHECK(energy == 300.0 * Energy::Wh);
+
+		QuantitySeries running = series.cumulative_integral();
+		REQUIRE(running.size() == 3);
+		CHECK(running.values()[0] == 0.0 * Energy::Wh);
+		CHECK(running.values()[1] == 100.0 * Energy::Wh);
+		CHECK(running.values()[2] == 300.0 * Energy::Wh);
+	}
+
+	SECTION("Resampling interpolates linearly")
+	{
+		QuantitySeries series(s, m);
+		series.push_back(0.0 * s, 0.0 * m);
+		series.push_back(10.0 * s, 10.0 * m);
+		series.push_back(30.0 * s, 50.0 * m);
+
+		QuantitySeries resampled = series.resample(Quantity(5.0, s));
+
+		REQUIRE(resampled.size() == 7);
+		CHECK(resampled.values()[1] == 5.0 * m);
+		CHECK(resampled.values()[3] == 20.0 * m);
+		CHECK(resampled.values()[6] == 50.0 * m);
+		CHECK(resampled.time()[4] == 20.0 * s);
+	}
+
+	SECTION("Resampling interval is converted to the time unit")
+	{
+		QuantitySeries series(min, m);
+		series.push_back(0.0 * min, 0.0 * m);
+		series.push_back(2.0 * min, 120.0 * m);
+
+		QuantitySeries resampled = series.resample(30.0 * s);
+		REQUIRE(resampled.size() == 5);
+		CHECK(resampled.values()[1] == 30.0 * m);
+	}
+
+	SECTION("Invalid resampling interval yields an empty series")
+	{
+		QuantitySeries series(s, m);
+		series.push_back(0.0 * s, 0.0 * m);
+		series.push_back(1.0 * s, 1.0 * m);
+
+		CHECK(series.resample(1.0 * m).empty());
+		CHECK(series.resample(-1.0 * s).empty());
+		CHECK(series.resample(1e-9 * s).empty());
+	}
+
+	SECTION("Unordered or non-finite times yield an empty resampled series")
+	{
+		QuantitySeries unordered(s, m);
+		unordered.push_back(10.0 * s, 0.0 * m);
+		unordered.push_back(0.0 * s, 1.0 * m);
+		CHECK(unordered.resample(1.0 * s).empty());
+
+		QuantitySeries nan(s, m);
+		nan.push_back(0.0 * s, 0.0 * m);
+		nan.push_back(Quantity(std::nan(""), s), 1.0 * m);
+		CHECK(nan.resample(1.0 * s).empty());
+	}
+}
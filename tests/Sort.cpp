@@ -0,0 +1,83 @@
+#include <limits>
+
+#include "Units/Units.h"
+#include "Units/Sort.h"
+
+#include "catch2/catch.hpp"
+
+using namespace Units;
+
+TEST_CASE("Sorting quantities", "[sort]")
+{
+	SECTION("Mixed compatible units are sorted by physical magnitude")
+	{
+		std::vector<Quantity> values = { 1.0 * mile, 1500.0 * m, Quantity(1.0, Unit(1000.0, m)), 3.0 * ft, -2.0 * m };
+
+		REQUIRE(sort(values));
+		CHECK(values[0].unit() == m);
+		CHECK(values[0].magnitude() == Approx(-2.0));
+		CHECK(values[1].unit() == ft);
+		CHECK(values[2].unit() == Unit(1000.0, m));
+		CHECK(values[3].unit() == m);
+		CHECK(values[4].unit() == mile);
+	}
+
+	SECTION("Incompatible dimensions are rejected")
+	{
+		std::vector<Quantity> values = { 2.0 * m, 1.0 * s };
+
+		CHECK_FALSE(sort(values));
+		CHECK(values[0] == 2.0 * m);
+		CHECK(top_k(values, 1).empty());
+	}
+
+	SECTION("Large ranges use the radix sort and are stable")
+	{
+		std::vector<Quantity> values;
+		for(int i = 0; i < 5000; i++)
+			values.push_back(i % 2 == 0 ? Quantity((double)((i * 7919) % 1000), m) : Quantity((double)((i * 7919) % 1000) / 1000.0, Unit(1000.0, m)));
+
+		values.push_back(Quantity(std::numeric_limits<double>::quiet_NaN(), m));
+		values.push_back(Quantity(-std::numeric_limits<double>::infinity(), m));
+
+		REQUIRE(stable_sort(values));
+		CHECK(std::isinf(values.front().magnitude()));
+		CHECK(std::isnan(values.back().magnitude()));
+
+		for(size_t i = 2; i + 1 < values.size(); i++)
+			CHECK_FALSE(values[i] < values[i - 1]);
+	}
+
+	SECTION("nth_element and top_k")
+	{
+		std::vector<Quantity> values = { 5.0 * s, 1.0 * min, 2.0 * s, 1.0 * h, 30.0 * s };
+
+		REQUIRE(nth_element(values, 2));
+		CHECK(values[2] == 30.0 * s);
+
+		const std::vector<Quantity> top = top_k(values, 2);
+		REQUIRE(top.size() == 2);
+		CHECK(top[0].unit() == h);
+		CHECK(top[1].unit() == min);
+	}
+
+	SECTION("Scales of kelvin are sorted linearly")
+	{
+		const Unit mK = Unit(1e-3, K);
+		std::vector<Quantity> values = { 500.0 * mK, 1.0 * K, 100.0 * mK, 2.0 * K };
+
+		REQUIRE(sort(values));
+		CHECK(values[0].magnitude() == Approx(100.0));
+		CHECK(values[1].magnitude() == Approx(500.0));
+		CHECK(values[2].magnitude() == Approx(1.0));
+		CHECK(values[3].magnitude() == Approx(2.0));
+	}
+
+	SECTION("Temperatures are normalized with their offset")
+	{
+		std::vector<Quantity> values = { 300.0 * K, 0.0 * Temperature::degF };
+
+		REQUIRE(sort(values));
+		CHECK(values[0].unit() == Temperature::degF);
+	}
+}
@@ -0,0 +1,186 @@
+#include <string>
+
+#include "Units/Units.h"
+#include "Units/IO.h"
+#include "Units/Ucum.h"
+
+#include "catch2/catch.hpp"
+
+using namespace Units;
+
+TEST_CASE("Parsing UCUM codes", "[unit][ucum]")
+{
+	SECTION("Atoms map onto the catalog")
+	{
+		CHECK(ucum_to_unit("m") == m);
+		CHECK(ucum_to_unit("g") == Unit(0.001, kg));
+		CHECK(ucum_to_unit("Cel") == Temperature::degC);
+		CHECK(ucum_to_unit("[degF]") == Temperature::degF);
+		CHECK(ucum_to_unit("[psi]") == Pressure::psi);
+		CHECK(ucum_to_unit("[in_i'Hg]") == Pressure::inHg);
+		CHECK(ucum_to_unit("[lb_av]") == lb);
+		CHECK(ucum_to_unit("Ohm") == ohm);
+		CHECK(ucum_to_unit("%") == percent);
+		CHECK(ucum_to_unit("L") == L);
+		CHECK(ucum_to_unit("l") == L);
+		CHECK(ucum_to_unit("cd") == Cd);
+		CHECK(ucum_to_unit("min") == min);
+		CHECK(ucum_to_unit("'") == Angle::arcmin);
+		CHECK(ucum_to_unit("''") == Angle::arcsec);
+	}
+
+	SECTION("Prefixes")
+	{
+		CHECK(ucum_to_unit("mm[Hg]") == Pressure::mmHg);
+		CHECK(ucum_to_unit("kPa") == Unit(1e3, Pa));
+		CHECK(ucum_to_unit("ug") == Unit(1e-9, kg));
+		CHECK(ucum_to_unit("dam") == Unit(10.0, m));
+		CHECK(ucum_to_unit("KiBy") == Unit(1024.0, Data::byte));
+		CHECK(ucum_to_unit("mCel") == Unit(1e-3, K));
+
+		// Only metric atoms accept a prefix, and whole atoms win over prefixes
+		CHECK(ucum_to_unit("k[psi]") == Unit::error());
+		CHECK(ucum_to_unit("kh") == Unit::error());
+		CHECK(ucum_to_unit("Pa") == Pa);
+		CHECK(ucum_to_unit("cd") == Cd);
+	}
+
+	SECTION("Products, quotients and exponents")
+	{
+		CHECK(ucum_to_unit("m.s-2") == m / (s^2));
+		CHECK(ucum_to_unit("m/s2") == m / (s^2));
+		CHECK(ucum_to_unit("kg.m2.s-2") == J);
+		CHECK(ucum_to_unit("kg/m.s") == kg * s / m);
+		CHECK(ucum_to_unit("/min") == (min^-1));
+		CHECK(ucum_to_unit("mL/min/[kg]") == Unit::error());
+		CHECK(ucum_to_unit("mL/min/kg") == Unit(1e-3, L) / min / kg);
+		CHECK(ucum_to_unit("m+2") == (m^2));
+		CHECK(ucum_to_unit("m-") == Unit::error());
+	}
+
+	SECTION("Factors, annotations and parentheses")
+	{
+		CHECK(ucum_to_unit("10*3/uL") == Unit(1e3, one) / Unit(1e-6, L));
+		CHECK(ucum_to_unit("10^-3") == Unit(1e-3, one));
+		CHECK(ucum_to_unit("100.g") == Unit(0.1, kg));
+		CHECK(ucum_to_unit("{cells}/uL") == (Unit(1e-6, L)^-1));
+		CHECK(ucum_to_unit("mg{creat}/dL") == Unit(1e-6, kg) / Unit(0.1, L));
+		CHECK(ucum_to_unit("kg/(m.s2)") == Pa);
+		CHECK(ucum_to_unit("J/(kg.(K))") == J / kg / K);
+		CHECK(ucum_to_unit("1") == one);
+	}
+
+	SECTION("Invalid codes")
+	{
+		CHECK(ucum_to_unit("") == Unit::error());
+		CHECK(ucum_to_unit("foo") == Unit::error());
+		CHECK(ucum_to_unit("m.") == Unit::error());
+		CHECK(ucum_to_unit("(m") == Unit::error());
+		CHECK(ucum_to_unit("m)") == Unit::error());
+		CHECK(ucum_to_unit("{cells") == Unit::error());
+		CHECK(ucum_to_unit("[psi") == Unit::error());
+		CHECK(ucum_to_unit("m s") == Unit::error());
+	}
+
+	SECTION("Parse results")
+	{
+		const std::string text = "mm[Hg], 120";
+		Unit un;
+
+		ParseResult result = parse_ucum(text.data(), text.data() + text.size(), un);
+		CHECK(result.ec == std::errc());
+		CHECK(result.ptr == text.data() + 6);
+		CHECK(un == Pressure::mmHg);
+
+		const std::string bad = "kg.[foo]";
+		un = m;
+		result = parse_ucum(bad.data(), bad.data() + bad.size(), un);
+		CHECK(result.ec == std::errc::invalid_argument);
+		CHECK(result.ptr == bad.data() + 3);
+		CHECK(un == m);
+
+		const std::string nested = "(((m)))";
+		result = parse_ucum(nested.data(), nested.data() + nested.size(), un, ParseLimits(2));
+		CHECK(result.ec == std::errc::value_too_large);
+		result = parse_ucum(nested.data(), nested.data() + nested.size(), un, ParseLimits(3));
+		CHECK(result.ec == std::errc());
+	}
+}
+
+TEST_CASE("Formatting UCUM codes", "[unit][ucum]")
+{
+	SECTION("Atoms and prefixes")
+	{
+		CHECK(to_ucum(m) == "m");
+		CHECK(to_ucum(kg) == "kg");
+		CHECK(to_ucum(Pressure::mmHg) == "mm[Hg]");
+		CHECK(to_ucum(Pressure::psi) == "[psi]");
+		CHECK(to_ucum(Unit(1e3, Pa)) == "kPa");
+		CHECK(to_ucum(Unit(1e-3, L)) == "mL");
+		CHECK(to_ucum(Temperature::degF) == "[degF]");
+		CHECK(to_ucum(Temperature::degC) == "K");
+		CHECK(to_ucum(one) == "1");
+	}
+
+	SECTION("Compound units")
+	{
+		CHECK(to_ucum(Unit(1e3, m) / h) == "km/h");
+		CHECK(to_ucum(L / min) == "L/min");
+		CHECK(to_ucum(Unit(1e-6, kg) / Unit(0.1, L)) == "mg/dL");
+		CHECK(to_ucum(kg / (m^3)) == "g/L");
+		CHECK(to_ucum(Unit(1e3, (kg^2) * (m^4))) == "10*3.kg2.m4");
+		CHECK(to_ucum(kg * (m^4)) == "kg.m4");
+		CHECK(to_ucum(m / (s^2)) == "m/s2");
+		CHECK(to_ucum(Unit(1e3, W) * h) == "kW.h");
+		CHECK(to_ucum(mol / L) == "mol/L");
+		CHECK(to_ucum(min^-1) == "/min");
+	}
+
+	SECTION("Powers and products of base units")
+	{
+		CHECK(to_ucum(m^2) == "m2");
+		CHECK(to_ucum(m^3) == "m3");
+		CHECK(to_ucum(m^4) == "m4");
+		CHECK(to_ucum(s^-2) == "/s2");
+		CHECK(to_ucum(kg * m) == "kg.m");
+		CHECK(to_ucum(Unit(1e3, m)^2) == "km2");
+		CHECK(to_ucum(ft^2) == "[ft_i]2");
+	}
+
+	SECTION("Dimensionless factors")
+	{
+		CHECK(to_ucum(Unit(1000.0, one)) == "10*3");
+		CHECK(to_ucum(Unit(100.0, one)) == "10*2");
+		CHECK(to_ucum(Unit(1e-2, one)) == "10*-2");
+		CHECK(to_ucum(Unit(7.0, one)) == "7");
+	}
+
+	SECTION("Units without a code")
+	{
+		CHECK(to_ucum(Unit::error()) == "");
+		CHECK(to_ucum(currency / kg) == "");
+		CHECK(to_ucum(Unit(0.3, m^5)) == "");
+		CHECK(to_ucum(Unit(1e3, count * (m^5))) == "");
+		CHECK(to_ucum(Unit(1e3, iflag * (m^5))) == "");
+	}
+
+	SECTION("Every base unit")
+	{
+		CHECK(to_ucum(Unit(1e3, kg * (m^-2) * (s^-3) * A * (K^2) * mol * rad * Cd)) == "10*3.kg.m-2.s-3.A.K2.mol.rad.cd");
+	}
+
+	SECTION("Round trips")
+	{
+		const char* codes[] = { "m.s-2", "mm[Hg]", "[psi]", "kg/m3", "mL/min", "10*3/uL", "[in_i]", "kW.h", "mol/L", "[ft_i]/s", "/min", "[drp]/min", "ng/mL" };
+
+		for(const char* code : codes)
+		{
+			const Unit un = ucum_to_unit(code);
+			REQUIRE(un != Unit::error());
+
+			const Unit back = ucum_to_unit(to_ucum(un));
+			CHECK(back.base_units() == un.base_units());
+			CHECK(back.multiplier() == Approx(un.multiplier()));
+		}
+	}
+}
@@ -296,3 +296,23 @@ TEST_CASE("Unit comparisons", "[unit][cmp]")
 		CHECK(kg != A );
 	}
 }
+
+TEST_CASE("Exponents of base units", "[unit]")
+{
+	CHECK(V.exponent(UnitData::METER) == 2);
+	CHECK(V.exponent(UnitData::KILOGRAM) == 1);
+	CHECK(V.exponent(UnitData::SECOND) == -3);
+	CHECK(V.exponent(UnitData::AMPERE) == -1);
+	CHECK(V.exponent(UnitData::KELVIN) == 0);
+	CHECK((mol / (Cd * rad)).exponent(UnitData::CANDELA) == -1);
+	CHECK((currency * count).exponent(UnitData::CURRENCY) == 1);
+	CHECK((currency * count).exponent(UnitData::COUNT) == 1);
+
+	// Every exponent is read back from the packed representation
+	const UnitData data = UnitData::from_exponents(-3, 2, -4, 3, 5, -1, 2, 1, -2, 1, false, false, false);
+	const Unit un = Unit::from_data(1.0f, data);
+	const int expected[] = { -3, 2, -4, 3, 5, -1, 2, 1, -2, 1 };
+
+	for(int base = UnitData::METER; base <= UnitData::COUNT; base++)
+		CHECK(un.exponent((UnitData::BaseUnit)base) == expected[base]);
+}
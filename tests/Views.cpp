@@ -0,0 +1,103 @@
+#include <cmath>
+#include <vector>
+
+#include "Units/Units.h"
+#include "Units/QuantityArray.h"
+#include "Units/Views.h"
+
+#include "catch2/catch.hpp"
+
+using namespace Units;
+
+TEST_CASE("Lazy views over quantities", "[views]")
+{
+	SECTION("Views compose with the pipe operator")
+	{
+		std::vector<Quantity> values = { 1500.0 * m, 2.0 * km, 250.0 * m };
+		std::vector<double> ret;
+
+		for(double x : values | views::convert_to(km) | views::magnitudes)
+			ret.push_back(x);
+
+		REQUIRE(ret.size() == 3);
+		CHECK(ret[0] == Approx(1.5));
+		CHECK(ret[1] == Approx(2.0));
+		CHECK(ret[2] == Approx(0.25));
+	}
+
+	SECTION("Converted views keep the target unit")
+	{
+		std::vector<Quantity> values = { 1.0 * h, 30.0 * min };
+		std::vector<Quantity> ret;
+
+		for(Quantity q : values | views::convert_to(s))
+			ret.push_back(q);
+
+		REQUIRE(ret.size() == 2);
+		CHECK(ret[0].unit() == s);
+		CHECK(ret[0].magnitude() == Approx(3600.0));
+		CHECK(ret[1].magnitude() == Approx(1800.0));
+	}
+
+	SECTION("Conversions to a quantity use it as the unit")
+	{
+		std::vector<Quantity> values = { 20.0 * m };
+		const auto view = values | views::convert_to(10.0 * m) | views::magnitudes;
+
+		CHECK(*view.begin() == Approx(2.0));
+	}
+
+	SECTION("Temperature offsets are applied")
+	{
+		std::vector<Quantity> values = { 0.0 * K, 100.0 * K };
+		std::vector<double> ret;
+
+		for(double x : values | views::convert_to(Temperature::degF) | views::magnitudes)
+			ret.push_back(x);
+
+		REQUIRE(ret.size() == 2);
+		CHECK(ret[0] == Approx(convert(values[0], Temperature::degF).magnitude()));
+		CHECK(ret[1] == Approx(convert(values[1], Temperature::degF).magnitude()));
+		CHECK(ret[1] - ret[0] == Approx(180.0));
+	}
+
+	SECTION("Incompatible elements yield NaN with an error unit")
+	{
+		std::vector<Quantity> values = { 1.0 * m, 1.0 * s };
+		std::vector<Quantity> ret;
+
+		for(Quantity q : values | views::convert_to(km))
+			ret.push_back(q);
+
+		REQUIRE(ret.size() == 2);
+		CHECK(ret[0].unit() == Unit(1000.0, m));
+		CHECK(ret[1].unit() == Unit::error());
+		CHECK(std::isnan(ret[1].magnitude()));
+	}
+
+	SECTION("Iterator pairs and quantity arrays are supported")
+	{
+		const Quantity values[] = { 1.0 * km, 2.0 * km };
+		const auto view = views::convert_to(m)(values, values + 2);
+
+		std::vector<Quantity> ret(view.begin(), view.end());
+		REQUIRE(ret.size() == 2);
+		CHECK(ret[1].magnitude() == Approx(2000.0));
+
+		QuantityArray array(std::vector<double>{ 1.0, 2.0, 3.0 }, Unit(1000.0, m));
+		double total = 0.0;
+
+		for(double x : array | views::convert_to(m) | views::magnitudes)
+			total += x;
+
+		CHECK(total == Approx(6000.0));
+	}
+
+	SECTION("Empty ranges produce empty views")
+	{
+		std::vector<Quantity> values;
+
+		CHECK((values | views::convert_to(km)).empty());
+		CHECK((values | views::magnitudes).empty());
+	}
+}